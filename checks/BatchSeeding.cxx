@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "Seeder/SeederHelixHelix.hxx"
+#include "Seeder/Simd.hxx"
+
+#include "SyntheticEvent.hxx"
+
+// Batched first phase of the V0 seeding, in double, vs seeding every pair one by one, as `FindV0s` does without it:
+// no pair that passes the post-seed cut of the one-pair path may be rejected by the batch.
+// Usage: check_BatchSeeding [N_TRACKS [MAX_DCA [SEED]]]
+int main(int argc, char *argv[]) {
+    using namespace T2DS;
+
+    const std::size_t n_tracks = argc > 1 ? std::stoul(argv[1]) : 4000;
+    const double max_dca = argc > 2 ? std::stod(argv[2]) : 1.;
+    const auto seed = static_cast<unsigned int>(argc > 3 ? std::stoul(argv[3]) : 1);
+
+    const Checks::SyntheticEvent event(n_tracks, seed);
+    std::vector<Seeder::TrackView::Row> rows_neg;
+    std::vector<Seeder::TrackView::Row> rows_pos;
+    event.AllPairs(rows_neg, rows_pos);
+    const std::size_t n_pairs = rows_neg.size();
+
+    // -- batch
+    std::vector<double> dca2(n_pairs);
+    std::vector<std::uint32_t> survivors(n_pairs);
+    Seeder::HelixHelix::SeedDCA2(event.store, rows_neg, event.store, rows_pos, dca2);
+    survivors.resize(Seeder::HelixHelix::CompactSurvivors(dca2, max_dca, survivors));
+    std::vector<bool> survived(n_pairs, false);
+    for (const std::uint32_t i : survivors) survived[i] = true;
+
+    // -- one by one, with the same cut as `PostSeedCuts`: NaN passes it
+    std::size_t n_accepted = 0;
+    std::size_t n_lost = 0;
+    double max_diff = 0.;
+    for (std::size_t i = 0; i < n_pairs; ++i) {
+        const auto [seed_neg, seed_pos, cache] = Seeder::HelixHelix::FastCorrectPCAs(event.store, rows_neg[i], event.store, rows_pos[i]);
+        const double dx = seed_neg.pca.xyz[0] - seed_pos.pca.xyz[0];
+        const double dy = seed_neg.pca.xyz[1] - seed_pos.pca.xyz[1];
+        const double dz = seed_neg.pca.xyz[2] - seed_pos.pca.xyz[2];
+        const double ref_dca2 = dx * dx + dy * dy + dz * dz;
+        if (ref_dca2 <= 4. * max_dca * max_dca) max_diff = std::max(max_diff, std::abs(std::sqrt(dca2[i]) - std::sqrt(ref_dca2)));
+        if (ref_dca2 > max_dca * max_dca) continue;
+        ++n_accepted;
+        if (!survived[i]) ++n_lost;
+    }
+
+    std::println("{} tracks, {} pairs, {} lanes of double: {} survivors of the batch, {} accepted one by one, {} lost", event.tracks.size(), n_pairs,
+                 Seeder::Simd::VecD::kWidth, survivors.size(), n_accepted, n_lost);
+    std::println("largest difference in the DCA within twice the cut of {} cm: {:.3e} cm, margin {:.3e} cm", max_dca, max_diff,
+                 Seeder::HelixHelix::kBatchMargin * max_dca);
+    return n_lost == 0 ? 0 : 1;
+}
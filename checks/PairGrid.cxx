@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory_resource>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "Seeder/PairGrid.hxx"
+#include "Seeder/SeederHelixHelix.hxx"
+
+#include "SyntheticEvent.hxx"
+
+// Partners of every negative track found through `PairGrid` vs trying every positive track, with the pre-seed cut of
+// `FindV0s`: the grid may not miss any pair that passes it. Prints the fraction of the pairs that the grid prunes, and
+// how long each way takes, best of `N_RUNS`.
+// Usage: check_PairGrid [N_TRACKS [MAX_DCA [SEED [N_RUNS]]]]
+int main(int argc, char *argv[]) {
+    using namespace T2DS;
+    using Clock = std::chrono::steady_clock;
+
+    const std::size_t n_tracks = argc > 1 ? std::stoul(argv[1]) : 4000;
+    const double max_dca = argc > 2 ? std::stod(argv[2]) : 1.;
+    const auto seed = static_cast<unsigned int>(argc > 3 ? std::stoul(argv[3]) : 1);
+    const std::size_t n_runs = argc > 4 ? std::stoul(argv[4]) : 5;
+
+    const Checks::SyntheticEvent event(n_tracks, seed);
+    const double max_gap = Seeder::HelixHelix::MaxGap_XY(max_dca);
+    const std::size_t n_pairs = event.neg.Size() * event.pos.Size();
+
+    // -- every pair
+    std::vector<bool> accepted(n_pairs, false);
+    std::size_t n_accepted = 0;
+    std::size_t n_outside = 0;  // -- close enough, but only outside the fiducial region
+    double ms_every_pair = 0.;
+    for (std::size_t run = 0; run < n_runs; ++run) {
+        const auto start = Clock::now();
+        n_accepted = 0;
+        for (std::size_t i_neg = 0; i_neg < event.neg.Size(); ++i_neg) {
+            for (std::size_t i_pos = 0; i_pos < event.pos.Size(); ++i_pos) {
+                const bool pass = Seeder::HelixHelix::MeetWithin_XY(event.store, event.neg[i_neg], event.store, event.pos[i_pos], max_gap);
+                accepted[i_neg * event.pos.Size() + i_pos] = pass;
+                n_accepted += static_cast<std::size_t>(pass);
+            }
+        }
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        ms_every_pair = run == 0 ? ms : std::min(ms_every_pair, ms);
+    }
+    for (std::size_t i_neg = 0; i_neg < event.neg.Size(); ++i_neg) {
+        for (std::size_t i_pos = 0; i_pos < event.pos.Size(); ++i_pos) {
+            const bool close = Seeder::HelixHelix::MinDistance_XY(event.store, event.neg[i_neg], event.store, event.pos[i_pos]) <= max_gap;
+            n_outside += static_cast<std::size_t>(close && !accepted[i_neg * event.pos.Size() + i_pos]);
+        }
+    }
+
+    // -- through the grid, as `FindV0s` runs it with `--pair-grid`
+    std::pmr::monotonic_buffer_resource memory;
+    Seeder::PairGrid grid(&memory);
+    std::pmr::vector<Seeder::PairGrid::Index> partners(&memory);
+    std::size_t n_partners = 0;
+    std::size_t n_missed = 0;
+    double ms_grid = 0.;
+    for (std::size_t run = 0; run < n_runs; ++run) {
+        const auto start = Clock::now();
+        n_partners = 0;
+        std::size_t n_passed = 0;
+        grid.Build(event.store, event.pos, max_gap);
+        for (std::size_t i_neg = 0; i_neg < event.neg.Size(); ++i_neg) {
+            grid.Query(event.store, event.neg[i_neg], partners);
+            n_partners += partners.size();
+            for (const Seeder::PairGrid::Index i_pos : partners) {
+                const bool pass = Seeder::HelixHelix::MeetWithin_XY(event.store, event.neg[i_neg], event.store, event.pos[i_pos], max_gap);
+                n_passed += static_cast<std::size_t>(pass);
+            }
+        }
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        ms_grid = run == 0 ? ms : std::min(ms_grid, ms);
+        n_missed = n_accepted - n_passed;
+    }
+
+    std::println("{} tracks, {} pairs, gap of {} cm: {} pass the pre-seed cut, {} more would without the fiducial region", event.tracks.size(),
+                 n_pairs, max_gap, n_accepted, n_outside);
+    std::println("grid: {} partners, {:.2f}% of the pairs pruned, {} missed", n_partners,
+                 100. * (1. - static_cast<double>(n_partners) / static_cast<double>(n_pairs)), n_missed);
+    std::println("best of {}: {:.1f} ms over every pair, {:.1f} ms through the grid, {:.2f}x", n_runs, ms_every_pair, ms_grid,
+                 ms_every_pair / ms_grid);
+    return n_missed == 0 ? 0 : 1;
+}
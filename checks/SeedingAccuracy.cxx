@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "Seeder/SeederHelixHelix.hxx"
+#include "Seeder/Simd.hxx"
+
+#include "SyntheticEvent.hxx"
+
+// Batched first phase of the V0 seeding, in double, with the polynomial `Atan2` and `SinCos` of `Simd.hxx`, vs the
+// one-pair path with libm:
+// - accuracy: the DCA and both PCAs of every pair within twice the cut, vs the tolerances of `--cross-check`;
+// - speed: the batch vs seeding every pair one by one, as the first phase of `FindV0s` did before, best of `N_RUNS`.
+// Usage: check_SeedingAccuracy [N_TRACKS [MAX_DCA [SEED [N_RUNS]]]]
+int main(int argc, char *argv[]) {
+    using namespace T2DS;
+    using Clock = std::chrono::steady_clock;
+
+    const std::size_t n_tracks = argc > 1 ? std::stoul(argv[1]) : 4000;
+    const double max_dca = argc > 2 ? std::stod(argv[2]) : 1.;
+    const auto seed = static_cast<unsigned int>(argc > 3 ? std::stoul(argv[3]) : 1);
+    const std::size_t n_runs = argc > 4 ? std::stoul(argv[4]) : 5;
+
+    const Checks::SyntheticEvent event(n_tracks, seed);
+    std::vector<Seeder::TrackView::Row> rows_neg;
+    std::vector<Seeder::TrackView::Row> rows_pos;
+    event.AllPairs(rows_neg, rows_pos);
+    const std::size_t n_pairs = rows_neg.size();
+
+    // -- one by one
+    std::vector<Seeder::Seed> ref_neg(n_pairs);
+    std::vector<Seeder::Seed> ref_pos(n_pairs);
+    double ms_one_by_one = 0.;
+    for (std::size_t run = 0; run < n_runs; ++run) {
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < n_pairs; ++i) {
+            std::tie(ref_neg[i], ref_pos[i], std::ignore) = Seeder::HelixHelix::FastCorrectPCAs(event.store, rows_neg[i], event.store, rows_pos[i]);
+        }
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        ms_one_by_one = run == 0 ? ms : std::min(ms_one_by_one, ms);
+    }
+
+    // -- batch, as `FindV0s` runs it
+    std::vector<double> dca2(n_pairs);
+    std::vector<std::uint32_t> survivors(n_pairs);
+    double ms_batch = 0.;
+    for (std::size_t run = 0; run < n_runs; ++run) {
+        const auto start = Clock::now();
+        Seeder::HelixHelix::SeedDCA2(event.store, rows_neg, event.store, rows_pos, dca2);
+        static_cast<void>(Seeder::HelixHelix::CompactSurvivors(dca2, max_dca, survivors));
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        ms_batch = run == 0 ? ms : std::min(ms_batch, ms);
+    }
+    std::vector<std::array<double, 3>> pca_neg(n_pairs);
+    std::vector<std::array<double, 3>> pca_pos(n_pairs);
+    Seeder::HelixHelix::SeedPCAs(event.store, rows_neg, event.store, rows_pos, pca_neg, pca_pos);
+
+    // -- near the cut, i.e. where a difference could move a pair across it, or move its vertex
+    auto distance = [](const std::array<double, 3> &a, const std::array<double, 3> &b) {
+        return std::sqrt((a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]) + (a[2] - b[2]) * (a[2] - b[2]));
+    };
+    std::size_t n_near = 0;
+    std::size_t n_off = 0;
+    double max_diff_dca = 0.;
+    double max_diff_pca = 0.;
+    for (std::size_t i = 0; i < n_pairs; ++i) {
+        const double dca = distance(ref_neg[i].pca.xyz, ref_pos[i].pca.xyz);
+        // -- not left to the one-pair path, as NaN
+        if (!(dca <= 2. * max_dca) || std::isnan(dca2[i])) continue;
+        ++n_near;
+        const double diff_dca = std::abs(std::sqrt(dca2[i]) - dca);
+        const double diff_pca = std::max(distance(pca_neg[i], ref_neg[i].pca.xyz), distance(pca_pos[i], ref_pos[i].pca.xyz));
+        if (!(diff_dca <= Seeder::HelixHelix::kBatchMargin * max_dca) || !(diff_pca <= Seeder::HelixHelix::kBatchTolerance_PCA)) ++n_off;
+        max_diff_dca = std::max(max_diff_dca, diff_dca);
+        max_diff_pca = std::max(max_diff_pca, diff_pca);
+    }
+
+    std::println("{} tracks, {} pairs, {} lanes of double, {} within twice the cut of {} cm", event.tracks.size(), n_pairs,
+                 Seeder::Simd::VecD::kWidth, n_near, max_dca);
+    std::println("largest difference: {:.3e} cm in the DCA (tolerance {:.3e} cm), {:.3e} cm in the PCAs (tolerance {:.3e} cm), {} off",
+                 max_diff_dca, Seeder::HelixHelix::kBatchMargin * max_dca, max_diff_pca, Seeder::HelixHelix::kBatchTolerance_PCA, n_off);
+    std::println("best of {}: {:.1f} ms one by one, {:.1f} ms batched, {:.2f}x", n_runs, ms_one_by_one, ms_batch, ms_one_by_one / ms_batch);
+    return n_off == 0 ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "Seeder/SeederHelixHelix.hxx"
+#include "Seeder/Simd.hxx"
+
+#include "SyntheticEvent.hxx"
+
+// Margins of the batched first phase of the V0 seeding over the DCA cut, in float and in double, vs the one-pair path:
+// for the pairs within twice the cut, the error of the DCA relative to the cut, by how well-conditioned the pair is --
+// the squared sine of the angle at which the circles cross, or of the angle between the momenta at the PCAs, whichever
+// is smaller, as `kIllConditioned` takes it. Pairs left to the one-pair path, as NaN, are counted apart.
+// Fails if a pair accepted one by one is rejected by either precision.
+// Usage: check_SeedingMargins [N_TRACKS [MAX_DCA [SEED]]]
+namespace {
+
+constexpr std::size_t kNBins = 13;  // -- decades of the conditioning, from 1E-12 and below, to 1 and above
+
+struct Margins {
+    std::array<std::size_t, kNBins> n_pairs{};
+    std::array<std::size_t, kNBins> n_deferred{};
+    std::array<double, kNBins> max_rel_error{};
+    std::size_t n_lost{0};
+};
+
+std::size_t Bin(double conditioning) {
+    const double decade = std::floor(std::log10(std::max(conditioning, 1E-300)));
+    return static_cast<std::size_t>(std::clamp(decade + 12., 0., static_cast<double>(kNBins - 1)));
+}
+
+void Print(const char *precision, double margin, const Margins &m) {
+    std::println("{}, margin {:.1e} of the cut, {} lost:", precision, margin, m.n_lost);
+    for (std::size_t bin = 0; bin < kNBins; ++bin) {
+        if (m.n_pairs[bin] == 0) continue;
+        std::println("  conditioning ~1E{:<3} {:>9} pairs, {:>7} left to the one-pair path, largest error {:.3e} of the cut",
+                     static_cast<int>(bin) - 12, m.n_pairs[bin], m.n_deferred[bin], m.max_rel_error[bin]);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    using namespace T2DS;
+
+    const std::size_t n_tracks = argc > 1 ? std::stoul(argv[1]) : 4000;
+    const double max_dca = argc > 2 ? std::stod(argv[2]) : 1.;
+    const auto seed = static_cast<unsigned int>(argc > 3 ? std::stoul(argv[3]) : 1);
+
+    const Checks::SyntheticEvent event(n_tracks, seed);
+    std::vector<Seeder::TrackView::Row> rows_neg;
+    std::vector<Seeder::TrackView::Row> rows_pos;
+    event.AllPairs(rows_neg, rows_pos);
+    const std::size_t n_pairs = rows_neg.size();
+
+    std::vector<float> dca2_float(n_pairs);
+    std::vector<double> dca2_double(n_pairs);
+    std::vector<std::uint32_t> survivors(n_pairs);
+    Seeder::HelixHelix::SeedDCA2(event.store, rows_neg, event.store, rows_pos, dca2_float);
+    Seeder::HelixHelix::SeedDCA2(event.store, rows_neg, event.store, rows_pos, dca2_double);
+    std::vector<bool> survived_float(n_pairs, false);
+    std::vector<bool> survived_double(n_pairs, false);
+    survivors.resize(Seeder::HelixHelix::CompactSurvivors(std::span<const float>(dca2_float), max_dca, survivors));
+    for (const std::uint32_t i : survivors) survived_float[i] = true;
+    survivors.resize(n_pairs);
+    survivors.resize(Seeder::HelixHelix::CompactSurvivors(std::span<const double>(dca2_double), max_dca, survivors));
+    for (const std::uint32_t i : survivors) survived_double[i] = true;
+
+    Margins in_float;
+    Margins in_double;
+    auto add = [&](Margins &m, std::size_t bin, double batch_dca2, double ref_dca, bool survived) {
+        if (ref_dca <= max_dca && !survived) ++m.n_lost;
+        if (!(ref_dca <= 2. * max_dca)) return;
+        ++m.n_pairs[bin];
+        if (std::isnan(batch_dca2)) {
+            ++m.n_deferred[bin];
+            return;
+        }
+        m.max_rel_error[bin] = std::max(m.max_rel_error[bin], std::abs(std::sqrt(batch_dca2) - ref_dca) / max_dca);
+    };
+    for (std::size_t i = 0; i < n_pairs; ++i) {
+        const auto [seed_neg, seed_pos, c] = Seeder::HelixHelix::FastCorrectPCAs(event.store, rows_neg[i], event.store, rows_pos[i]);
+        const double dx = seed_neg.pca.xyz[0] - seed_pos.pca.xyz[0];
+        const double dy = seed_neg.pca.xyz[1] - seed_pos.pca.xyz[1];
+        const double dz = seed_neg.pca.xyz[2] - seed_pos.pca.xyz[2];
+        const double ref_dca = std::sqrt(dx * dx + dy * dy + dz * dz);
+        // -- the same conditioning as the batch takes it, from the one-pair cache
+        const double sin2_crossing = 1. - c.kd * c.kd / (c.pt12 * c.pt22);
+        const double sin2_momenta = c.p12 * c.p22 > 0. ? -c.detp / (c.p12 * c.p22) : 0.;
+        const std::size_t bin = Bin(std::min(std::abs(sin2_crossing), sin2_momenta));
+        add(in_float, bin, static_cast<double>(dca2_float[i]), ref_dca, survived_float[i]);
+        add(in_double, bin, dca2_double[i], ref_dca, survived_double[i]);
+    }
+
+    std::println("{} tracks, {} pairs, cut of {} cm, within twice the cut:", event.tracks.size(), n_pairs, max_dca);
+    Print("float", Seeder::HelixHelix::kBatchMargin_Float, in_float);
+    Print("double", Seeder::HelixHelix::kBatchMargin, in_double);
+    return in_float.n_lost == 0 && in_double.n_lost == 0 ? 0 : 1;
+}
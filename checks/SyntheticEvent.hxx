@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "common/POD_Track.hpp"
+
+#include "Seeder/TrackStore.hxx"
+
+namespace T2DS::Checks {
+
+inline constexpr double kMagneticField = 5.;  // HARDCODED, kG
+
+// Tracks of a synthetic event: prompt tracks from around the primary vertex, and the daughters of V0s decaying at
+// radii within [1, 100] cm -- so that there are pairs at every distance from the DCA cuts, including right at them.
+// Half of the tracks are negative, half positive.
+struct SyntheticEvent {
+    SyntheticEvent(std::size_t n_tracks, unsigned int seed) {
+        std::mt19937_64 rng{seed};
+        std::uniform_real_distribution<double> uniform(0., 1.);
+        std::normal_distribution<double> gauss(0., 1.);
+
+        auto make_track = [&](double x, double y, double z, double charge) {
+            const double pt = 0.1 - 0.4 * std::log(uniform(rng));  // -- GeV/c, exponential above 0.1
+            const double phi = 2. * std::numbers::pi * uniform(rng);
+            POD::Track track{};
+            track.X = static_cast<decltype(track.X)>(x);
+            track.Y = static_cast<decltype(track.Y)>(y);
+            track.Z = static_cast<decltype(track.Z)>(z);
+            track.Px = static_cast<decltype(track.Px)>(pt * std::cos(phi));
+            track.Py = static_cast<decltype(track.Py)>(pt * std::sin(phi));
+            track.Pz = static_cast<decltype(track.Pz)>(pt * gauss(rng));
+            track.Charge = static_cast<decltype(track.Charge)>(charge);
+            return track;
+        };
+
+        // -- a fifth of the pairs come from V0s, the rest are prompt
+        tracks.reserve(n_tracks);
+        while (tracks.size() + 1 < n_tracks) {
+            if (uniform(rng) < 0.2) {
+                const double radius = 1. + 99. * uniform(rng);
+                const double phi = 2. * std::numbers::pi * uniform(rng);
+                const double z = 10. * gauss(rng);
+                tracks.push_back(make_track(radius * std::cos(phi), radius * std::sin(phi), z, -1.));
+                tracks.push_back(make_track(radius * std::cos(phi), radius * std::sin(phi), z, +1.));
+            } else {
+                const double z = 5. * gauss(rng);
+                tracks.push_back(make_track(0.01 * gauss(rng), 0.01 * gauss(rng), z, -1.));
+                tracks.push_back(make_track(0.01 * gauss(rng), 0.01 * gauss(rng), z, +1.));
+            }
+        }
+
+        store.Reset(tracks, kMagneticField);
+        for (std::size_t i = 0; i < tracks.size(); ++i) {
+            store.Add(static_cast<Seeder::TrackStore::Entry>(i), 0);
+            (tracks[i].Charge < 0 ? neg : pos).rows.push_back(static_cast<Seeder::TrackView::Row>(i));
+        }
+    }
+
+    // Every (negative, positive) pair, as a block of the batched seeding takes them.
+    void AllPairs(std::vector<Seeder::TrackView::Row> &rows_neg, std::vector<Seeder::TrackView::Row> &rows_pos) const {
+        rows_neg.clear();
+        rows_pos.clear();
+        for (std::size_t i_neg = 0; i_neg < neg.Size(); ++i_neg) {
+            for (std::size_t i_pos = 0; i_pos < pos.Size(); ++i_pos) {
+                rows_neg.push_back(neg[i_neg]);
+                rows_pos.push_back(pos[i_pos]);
+            }
+        }
+    }
+
+    std::vector<POD::Track> tracks;
+    Seeder::TrackStore store;
+    Seeder::TrackView neg;
+    Seeder::TrackView pos;
+};
+
+}  // namespace T2DS::Checks
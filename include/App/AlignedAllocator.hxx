@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace T2DS {
+
+// Allocator for `std::vector`s whose data must start on an `Alignment`-byte boundary, e.g. the columns of a
+// structure-of-arrays that are streamed through by vectorized loops.
+template <typename T, std::size_t Alignment = 64>
+struct AlignedAllocator {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two, at least alignof(T).");
+
+    using value_type = T;
+
+    // NOTE: needed explicitly, as the non-type template parameter keeps the default `rebind` from working
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+    // NOTE: implicit on purpose, as containers convert between rebound allocators
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment> & /*other*/) noexcept {}
+
+    [[nodiscard]] T *allocate(std::size_t n) { return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{Alignment})); }
+    void deallocate(T *ptr, std::size_t /*n*/) noexcept { ::operator delete(ptr, std::align_val_t{Alignment}); }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment> & /*other*/) const noexcept {
+        return true;
+    }
+};
+
+template <typename T, std::size_t Alignment = 64>
+using AlignedVector = std::vector<T, AlignedAllocator<T, Alignment>>;
+
+}  // namespace T2DS
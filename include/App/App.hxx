@@ -1,31 +1,391 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
 
+#include <TFileMerger.h>
+#include <TROOT.h>
+
+#include "App/Logger.hxx"
+#include "App/Metrics.hxx"
+#include "App/Progress.hxx"
 #include "App/Settings.hxx"
+#include "App/SpscQueue.hxx"
 
 namespace T2DS {
 
+// ## Entry selection ## //
+
+// A contiguous range of global entries `[first, last)`, counted across the readable input files in order.
+struct EntryRange {
+    unsigned long first{0};
+    unsigned long last{std::numeric_limits<unsigned long>::max()};
+};
+
+// A contiguous range of entries `[first, last)` of a single input file.
+struct WorkUnit {
+    std::size_t file_idx{0};
+    unsigned long first{0};
+    unsigned long last{0};
+};
+
+// Number of entries of each input file, in order -- none for the files that couldn't be read.
+using EntryCounts = std::vector<std::optional<unsigned long>>;
+
+// Open the input files in order to count their entries, until the global entry `until` is reached.
+template <typename Worker>
+EntryCounts CountEntries(Worker &probe, const T2DS::Settings &settings, unsigned long until) {
+    EntryCounts n_entries;
+    unsigned long offset = 0;
+    for (const auto &input_path : settings.PathInputFiles) {
+        if (offset >= until) break;
+        if (probe.OpenInput(input_path)) {
+            n_entries.emplace_back(probe.NumberEventsToRead());
+            offset += *n_entries.back();
+        } else {
+            n_entries.emplace_back(std::nullopt);
+        }
+    }
+    return n_entries;
+}
+
+// Call `visit_file(file_idx, first, last)` with the entries `[first, last)` of each counted file that fall into `range`.
+template <typename VisitFile>
+void ForEachSelectedRange(const EntryCounts &n_entries, const EntryRange &range, const VisitFile &visit_file) {
+    unsigned long offset = 0;
+    for (std::size_t file_idx = 0; file_idx < n_entries.size() && offset < range.last; ++file_idx) {
+        if (!n_entries[file_idx]) continue;
+        const auto first = std::min(range.first > offset ? range.first - offset : 0, *n_entries[file_idx]);
+        const auto last = std::min(range.last - offset, *n_entries[file_idx]);
+        offset += *n_entries[file_idx];
+        if (first < last) visit_file(file_idx, first, last);
+    }
+}
+
+// Resolve `--first-event/--last-event`, or `--shard`, and `-n` into a single range of global entries.
+// NOTE: `--shard` needs the number of entries of every input file, thus they are all opened once beforehand; their
+//       counts are kept in `n_entries`, which is left empty otherwise, so that no file has to be counted again.
+template <typename Worker>
+EntryRange SelectEntries(Worker &probe, const T2DS::Settings &settings, EntryCounts &n_entries) {
+
+    EntryRange range;
+    if (settings.FirstEvent.has_value()) range.first = settings.FirstEvent.value();
+    if (settings.LastEvent.has_value()) range.last = settings.LastEvent.value() + 1;
+
+    n_entries.clear();
+    if (settings.NShards > 1) {
+        n_entries = CountEntries(probe, settings, std::numeric_limits<unsigned long>::max());
+        unsigned long n_total = 0;
+        for (const auto &n : n_entries) n_total += n.value_or(0);
+        // -- consecutive shards differ by at most one entry
+        range.first = n_total * settings.ShardIndex / settings.NShards;
+        range.last = n_total * (settings.ShardIndex + 1) / settings.NShards;
+        Logger::Info(__FUNCTION__, "Shard {}/{} :: entries [{}, {}) out of {}.", settings.ShardIndex, settings.NShards, range.first, range.last,
+                     n_total);
+    }
+
+    // `-n` counts from the first selected entry
+    if (settings.LimitToNEvents.has_value() && range.last - range.first > settings.LimitToNEvents.value()) {
+        range.last = range.first + settings.LimitToNEvents.value();
+    }
+    if (settings.NShards > 1) Progress::SetTotal(range.last - range.first);  // -- exact, after the pre-scan
+    return range;
+}
+
+// Open every input file in turn, calling `visit_file(file_idx, first, last)` with the entries `[first, last)` of each
+// that fall into the selection. Unreadable files are skipped, and don't count towards the global entry numbers.
+template <typename Worker, typename VisitFile>
+void ForEachSelectedFile(Worker &worker, const T2DS::Settings &settings, const VisitFile &visit_file) {
+
+    EntryCounts n_entries;
+    const EntryRange range = SelectEntries(worker, settings, n_entries);
+    const auto &input_paths = settings.PathInputFiles;
+
+    // -- already counted: only the files with selected entries are opened again, and pre-opened in turn
+    if (!n_entries.empty()) {
+        std::vector<WorkUnit> selected;
+        ForEachSelectedRange(n_entries, range, [&](std::size_t file_idx, unsigned long first, unsigned long last) {
+            selected.push_back({.file_idx = file_idx, .first = first, .last = last});
+        });
+        for (std::size_t i = 0; i < selected.size(); ++i) {
+            const bool opened = worker.OpenInput(input_paths[selected[i].file_idx]);
+            if (i + 1 < selected.size()) worker.PreOpenInput(input_paths[selected[i + 1].file_idx], static_cast<long long>(selected[i + 1].first));
+            if (opened) visit_file(selected[i].file_idx, selected[i].first, selected[i].last);
+        }
+        return;
+    }
+
+    unsigned long offset = 0;  // global number of the first entry of the current file
+    for (std::size_t file_idx = 0; file_idx < input_paths.size(); ++file_idx) {
+        if (offset >= range.last) break;
+        const bool opened = worker.OpenInput(input_paths[file_idx]);
+
+        const auto n_entries_file = opened ? worker.NumberEventsToRead() : 0;
+        const auto first = std::min(range.first > offset ? range.first - offset : 0, n_entries_file);
+        const auto last = std::min(range.last - offset, n_entries_file);
+        offset += n_entries_file;
+        // open the next file, and read its first selected entry, while this one is processed -- even if this one
+        // couldn't be read; no-op, unless `--pre-open`
+        if (file_idx + 1 < input_paths.size() && offset < range.last) {
+            const auto next_first = range.first > offset ? range.first - offset : 0;
+            worker.PreOpenInput(input_paths[file_idx + 1], static_cast<long long>(next_first));
+        }
+
+        if (first < last) visit_file(file_idx, first, last);
+    }
+}
+
+// Open every input file in turn, calling `visit(id_event, last)` for each selected entry, where `last` is one past the
+// last entry to be read from the current file.
+// NOTE: the caller reports each event to `Progress` once it's done with it, which may be well after `visit` returns
+template <typename Worker, typename Visit>
+void ForEachInputEntry(Worker &worker, const T2DS::Settings &settings, const Visit &visit) {
+    ForEachSelectedFile(worker, settings, [&](std::size_t file_idx, unsigned long first, unsigned long last) {
+        Progress::OpenedFile(file_idx, last - first);
+        for (unsigned long id_event = first; id_event < last; ++id_event) visit(id_event, last);
+        Metrics::CountEvents(file_idx, last - first);
+    });
+}
+
 // Read every event of every input file, calling `process_event` on each.
 // Possible `Worker`: `Finder`, `Verifier`.
 template <typename Worker, typename ProcessEvent>
 void RunOverInputs(Worker &worker, const T2DS::Settings &settings, const ProcessEvent &process_event) {
+    ForEachInputEntry(worker, settings, [&](unsigned long id_event, unsigned long last) {
+        worker.Load(static_cast<long long>(id_event));
+        if (id_event + 1 < last) worker.ReadAhead(static_cast<long long>(id_event + 1));  // no-op, unless `--read-ahead`
+        process_event();
+        Progress::EventDone();
+    });
+}
 
-    // `remaining` clamps the total number of events to be read from *all* files, not per file
-    auto remaining = settings.LimitToNEvents.has_value() ? settings.LimitToNEvents.value() : std::numeric_limits<unsigned long>::max();
+// ## Event-parallel mode ## //
 
-    for (const auto &input_path : settings.PathInputFiles) {
-        if (remaining == 0) break;
-        if (!worker.OpenInput(input_path)) continue;  // unreadable files are skipped
+// Small enough to balance the load between threads, large enough for a worker to stay on the same file for a while.
+inline constexpr unsigned long kEventsPerWorkUnit = 16;  // HARDCODED
 
-        const auto n_events = std::min(worker.NumberEventsToRead(), remaining);
-        for (unsigned long id_event = 0; id_event < n_events; ++id_event) {
-            worker.Load(id_event);
-            process_event();
+// Split the selected entries into work units, following the same rules as `RunOverInputs`. `probe` is only used to
+// count the entries of each file, once -- reusing the counts of `--shard`, if any.
+template <typename Worker>
+std::vector<WorkUnit> PlanWorkUnits(Worker &probe, const T2DS::Settings &settings) {
+    EntryCounts n_entries;
+    const EntryRange range = SelectEntries(probe, settings, n_entries);
+    if (n_entries.empty()) n_entries = CountEntries(probe, settings, range.last);
+
+    std::vector<WorkUnit> units;
+    ForEachSelectedRange(n_entries, range, [&](std::size_t file_idx, unsigned long first_entry, unsigned long last_entry) {
+        for (unsigned long first = first_entry; first < last_entry; first += kEventsPerWorkUnit) {
+            units.push_back({.file_idx = file_idx, .first = first, .last = std::min(first + kEventsPerWorkUnit, last_entry)});
         }
-        remaining -= n_events;
+    });
+    return units;
+}
+
+// Path of the partial output of thread `id_thread`, placed next to the final output.
+// For example: "FoundRNT.root" -> "FoundRNT_thread3.root".
+inline std::string PartialOutputPath(const std::string &path, unsigned int id_thread) {
+    std::filesystem::path partial_path(path);
+    partial_path.replace_filename(std::format("{}_thread{}{}", partial_path.stem().string(), id_thread, partial_path.extension().string()));
+    return partial_path.string();
+}
+
+// Merge the partial outputs into `output_path`: RNTuples are concatenated and histograms are added up.
+// The partial files are removed only if the merge succeeded, so nothing is lost otherwise.
+inline bool MergePartialOutputs(const std::vector<std::string> &partial_paths, const std::string &output_path) {
+
+    TFileMerger merger(false, false);
+    merger.SetPrintLevel(0);
+    if (!merger.OutputFile(output_path.c_str(), "RECREATE")) {
+        Logger::Error(__FUNCTION__, "Couldn't create {}.", output_path);
+        return false;
+    }
+    for (const auto &partial_path : partial_paths) merger.AddFile(partial_path.c_str(), false);
+    if (!merger.Merge()) {
+        Logger::Error(__FUNCTION__, "Couldn't merge partial outputs into {} -- keeping them.", output_path);
+        return false;
+    }
+
+    for (const auto &partial_path : partial_paths) std::filesystem::remove(partial_path);
+    Logger::Info(__FUNCTION__, "Merged {} partial outputs into {}.", partial_paths.size(), output_path);
+    return true;
+}
+
+// Event-parallel version of `RunOverInputs`. Every thread owns a full `Worker` -- with its own reader, transient
+// vectors, output buffer and histograms -- and pulls work units from a shared queue, so no state is shared while
+// processing events. Each worker writes into its own partial file, and these are merged into the requested output
+// once every worker has been torn down.
+// NOTE: the entries of the merged RNTuple are grouped by thread, thus they don't follow the order of the input.
+// NOTE: `--pre-open` has no effect here, as threads don't visit the files in a predictable order.
+template <typename Worker, typename ProcessEvent>
+bool RunOverInputsParallel(const T2DS::Settings &settings, const ProcessEvent &process_event) {
+
+    ROOT::EnableThreadSafety();
+
+    const unsigned int n_threads = settings.NThreads;
+
+    // workers keep a reference to their settings, so these must outlive them
+    std::vector<T2DS::Settings> thread_settings(n_threads, settings);
+    std::vector<std::string> partial_paths;
+    std::vector<std::unique_ptr<Worker>> workers;
+    for (unsigned int id_thread = 0; id_thread < n_threads; ++id_thread) {
+        thread_settings[id_thread].PathOutputFile = PartialOutputPath(settings.PathOutputFile, id_thread);
+        partial_paths.push_back(thread_settings[id_thread].PathOutputFile);
+        workers.push_back(std::make_unique<Worker>(thread_settings[id_thread]));
     }
+
+    const auto units = PlanWorkUnits(*workers.front(), settings);
+    Logger::Info(__FUNCTION__, "Processing {} work units with {} threads.", units.size(), n_threads);
+    unsigned long n_events = 0;
+    for (const auto &unit : units) n_events += unit.last - unit.first;
+    Progress::SetTotal(n_events);
+
+    std::atomic<std::size_t> next_unit{0};
+    auto run_thread = [&](Worker &worker) {
+        std::optional<std::size_t> open_file_idx;
+        for (auto unit_idx = next_unit.fetch_add(1, std::memory_order_relaxed); unit_idx < units.size();
+             unit_idx = next_unit.fetch_add(1, std::memory_order_relaxed)) {
+            const auto &unit = units[unit_idx];
+            if (open_file_idx != unit.file_idx) {
+                if (!worker.OpenInput(settings.PathInputFiles[unit.file_idx])) continue;
+                open_file_idx = unit.file_idx;
+                Progress::OpenedFile(unit.file_idx, 0);  // the total is already known
+            }
+            for (unsigned long id_event = unit.first; id_event < unit.last; ++id_event) {
+                worker.Load(static_cast<long long>(id_event));
+                if (id_event + 1 < unit.last) worker.ReadAhead(static_cast<long long>(id_event + 1));
+                process_event(worker);
+                Progress::EventDone();
+            }
+            Metrics::CountEvents(unit.file_idx, unit.last - unit.first);
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        for (auto &worker : workers) threads.emplace_back(run_thread, std::ref(*worker));
+    }  // -- threads are joined here
+
+    bool any_events = false;
+    for (auto &worker : workers) any_events |= worker->EndOfAnalysis();
+    workers.clear();  // commit every RNTuple and close every partial file before merging
+
+    return MergePartialOutputs(partial_paths, settings.PathOutputFile) && any_events;
+}
+
+// ## Pipelined mode ## //
+
+// Capacity of the queues between stages; the number of events in flight is bounded by `n_stages + 2`.
+inline constexpr std::size_t kPipelineQueueSize = 8;  // HARDCODED
+
+// Stage-pipelined version of `RunOverInputs`, for workers that keep their per-event data in a `Worker::EventState`.
+// The calling thread decodes the input, while each of the `stages` -- callables `(Worker&, Worker::EventState&)` --
+// runs on a dedicated thread. Consecutive stages are connected by bounded lock-free queues carrying pointers to event
+// states, and the last stage hands them back to the decoder to be reused. As every stage has a single thread and every
+// queue is FIFO, events leave the pipeline in input order.
+template <typename Worker, typename... Stages>
+bool RunOverInputsPipelined(const T2DS::Settings &settings, const Stages &...stages) {
+
+    using EventState = typename Worker::EventState;
+    constexpr std::size_t n_stages = sizeof...(Stages);
+    // -- one event per stage, plus one being decoded and one waiting in between
+    constexpr std::size_t n_event_states = n_stages + 2;
+    // -- at the end, the queue of free states also holds the end-of-input marker
+    static_assert(n_event_states + 1 <= kPipelineQueueSize);
+
+    ROOT::EnableThreadSafety();
+
+    Worker worker(settings);
+
+    // `queues[i]` feeds stage `i`, while `queues[n_stages]` returns the free event states to the decoder
+    std::array<SpscQueue<EventState *, kPipelineQueueSize>, n_stages + 1> queues;
+    auto &free_states = queues[n_stages];
+
+    std::vector<std::unique_ptr<EventState>> event_states;
+    for (std::size_t i = 0; i < n_event_states; ++i) {
+        event_states.push_back(std::make_unique<EventState>());
+        free_states.Push(event_states.back().get());
+    }
+
+    const std::array<std::function<void(Worker &, EventState &)>, n_stages> stage_fns{stages...};
+
+    // the first exception thrown by a stage or by the decoder, rethrown once every thread has been joined //
+    // -- after it, events are only passed along, without processing them, so that the pipeline drains
+    std::mutex error_mutex;
+    std::exception_ptr error;
+    std::atomic<bool> failed{false};
+    auto keep_error = [&] {
+        std::lock_guard lock(error_mutex);
+        if (!error) error = std::current_exception();
+        failed.store(true, std::memory_order_release);
+    };
+
+    // -- pushes the end-of-input marker when going out of scope, however its owner leaves
+    struct EndOfInput {
+        SpscQueue<EventState *, kPipelineQueueSize> &queue;
+        ~EndOfInput() { queue.Push(nullptr); }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t id_stage = 0; id_stage < n_stages; ++id_stage) {
+            threads.emplace_back([&, id_stage] {
+                // a null pointer marks the end of input, and is passed along once everything before it went through
+                const EndOfInput end_of_input{queues[id_stage + 1]};
+                while (EventState *ev = queues[id_stage].Pop()) {
+                    if (!failed.load(std::memory_order_acquire)) {
+                        try {
+                            stage_fns[id_stage](worker, *ev);
+                            if (id_stage + 1 == n_stages) Progress::EventDone();  // -- only once it went through every stage
+                        } catch (...) {
+                            keep_error();
+                        }
+                    }
+                    queues[id_stage + 1].Push(ev);
+                }
+            });
+        }
+
+        const EndOfInput end_of_input{queues.front()};
+        try {
+            ForEachInputEntry(worker, settings, [&](unsigned long id_event, unsigned long last) {
+                if (failed.load(std::memory_order_acquire)) std::rethrow_exception(error);  // -- stop decoding
+                EventState *ev = free_states.Pop();
+                worker.Load(static_cast<long long>(id_event), *ev);
+                if (id_event + 1 < last) worker.ReadAhead(static_cast<long long>(id_event + 1));  // no-op, unless `--read-ahead`
+                queues.front().Push(ev);
+            });
+        } catch (...) {
+            keep_error();
+        }
+    }  // -- the end-of-input marker is pushed, then threads are joined here
+
+    if (error) std::rethrow_exception(error);
+    return worker.EndOfAnalysis();
+}
+
+// Run a `Worker` over all inputs, single-threaded by default or event-parallel if requested with `--threads`.
+template <typename Worker, typename ProcessEvent>
+bool Run(const T2DS::Settings &settings, const ProcessEvent &process_event) {
+
+    if (settings.NThreads > 1) return RunOverInputsParallel<Worker>(settings, process_event);
+    if (settings.ReadAhead || settings.PreOpen || settings.NTasks > 1) ROOT::EnableThreadSafety();
+
+    Worker worker(settings);
+    RunOverInputs(worker, settings, [&] { process_event(worker); });
+    return worker.EndOfAnalysis();
 }
 
 }  // namespace T2DS
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "App/Logger.hxx"
+
+namespace T2DS {
+
+// Memory of the transient containers of a single event: a monotonic arena, where allocating only bumps a pointer and
+// deallocating is a no-op, released as a whole at the end of the event. Its buffer is kept across events, and grown to
+// the largest event seen so far, so that once warmed up, events don't touch the heap at all.
+// Allocations are serialised, as the tasks of an event grow their own containers concurrently -- as growth is
+// amortised, the lock is rarely contended.
+class Arena final : public std::pmr::memory_resource {
+   public:
+    static constexpr std::size_t kInitialSize = std::size_t{1} << 20;  // HARDCODED, 1 MiB
+
+    explicit Arena(std::size_t initial_size = kInitialSize) : fBuffer(initial_size) { fMonotonic.emplace(fBuffer.data(), fBuffer.size()); }
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+    ~Arena() override = default;
+
+    // Give every allocation back at once. Every container using the arena must have dropped its storage by now.
+    void Release() {
+        std::lock_guard lock(fMutex);
+        RecordHighWater(fUsed);
+        if (fUsed > fBuffer.size()) {
+            // -- the event overflowed into the heap, grow the buffer to fit it whole next time
+            fMonotonic.reset();
+            fBuffer = std::vector<std::byte>(fUsed);
+            fMonotonic.emplace(fBuffer.data(), fBuffer.size());
+            gNGrowths.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            fMonotonic->release();
+        }
+        fUsed = 0;
+    }
+
+    // Print the high-water mark over all the arenas of the job. Only at the end of the job, see `PerThread.hxx`.
+    static void Report() {
+        const auto high_water = gHighWater.load(std::memory_order_relaxed);
+        Logger::Info("Arena", "High-water mark = {:.1f} KiB per event, over {} events", static_cast<double>(high_water) / 1024., gNEvents.load());
+        Logger::Info("Arena", "Grown           = {} times, from an initial {:.1f} KiB", gNGrowths.load(), static_cast<double>(kInitialSize) / 1024.);
+    }
+
+   private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        std::lock_guard lock(fMutex);
+        fUsed += bytes + alignment - 1;  // -- worst case padding, so that a buffer this large always fits the event
+        return fMonotonic->allocate(bytes, alignment);
+    }
+    void do_deallocate(void * /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) override {}
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+    static void RecordHighWater(std::size_t used) {
+        gNEvents.fetch_add(1, std::memory_order_relaxed);
+        std::size_t prev = gHighWater.load(std::memory_order_relaxed);
+        while (prev < used && !gHighWater.compare_exchange_weak(prev, used, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::mutex fMutex;
+    std::vector<std::byte> fBuffer;
+    std::optional<std::pmr::monotonic_buffer_resource> fMonotonic;
+    std::size_t fUsed{0};  // -- bytes requested since the last release
+
+    // -- summed over all arenas, see `Report()`
+    static inline std::atomic<std::size_t> gHighWater{0};
+    static inline std::atomic<std::uint64_t> gNEvents{0};
+    static inline std::atomic<std::uint64_t> gNGrowths{0};
+};
+
+// Empty a container and give its storage back to its arena, as required before releasing it.
+template <typename Container>
+void Drop(Container &container) {
+    Container(container.get_allocator()).swap(container);
+}
+
+}  // namespace T2DS
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace T2DS {
+
+// A single persistent background thread, running the submitted jobs one at a time and in submission order.
+// Cheaper than spawning a thread per job, which matters when a job is as short as reading a single event.
+class AsyncWorker {
+   public:
+    AsyncWorker(const AsyncWorker &) = delete;
+    AsyncWorker(AsyncWorker &&) = delete;
+    AsyncWorker &operator=(const AsyncWorker &) = delete;
+    AsyncWorker &operator=(AsyncWorker &&) = delete;
+
+    AsyncWorker() : fThread{[this] { Loop(); }} {}
+
+    // pending jobs are still run before the thread is joined
+    ~AsyncWorker() {
+        {
+            std::lock_guard lock(fMutex);
+            fStopping = true;
+        }
+        fCondition.notify_all();
+    }
+
+    void Submit(std::function<void()> job) {
+        {
+            std::lock_guard lock(fMutex);
+            fJobs.push_back(std::move(job));
+        }
+        fCondition.notify_all();
+    }
+
+    // Block until every submitted job has finished. If any of them threw, rethrow its exception here.
+    void Wait() {
+        std::unique_lock lock(fMutex);
+        fCondition.wait(lock, [this] { return fJobs.empty() && !fBusy; });
+        if (fError) std::rethrow_exception(std::exchange(fError, nullptr));
+    }
+
+   private:
+    void Loop() {
+        std::unique_lock lock(fMutex);
+        while (true) {
+            fCondition.wait(lock, [this] { return fStopping || !fJobs.empty(); });
+            if (fJobs.empty()) return;
+
+            auto job = std::move(fJobs.front());
+            fJobs.pop_front();
+            fBusy = true;
+            lock.unlock();
+
+            std::exception_ptr error;
+            try {
+                job();
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            if (error) fError = error;
+            fBusy = false;
+            fCondition.notify_all();
+        }
+    }
+
+    std::mutex fMutex;
+    std::condition_variable fCondition;
+    std::deque<std::function<void()>> fJobs;
+    std::exception_ptr fError;
+    bool fBusy{false};
+    bool fStopping{false};
+
+    std::jthread fThread;  // last: started once every other member is ready, joined before any of them is destroyed
+};
+
+}  // namespace T2DS
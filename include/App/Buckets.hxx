@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+
+namespace T2DS {
+
+// Group items into `n_buckets` buckets, in compressed-sparse-row form: the items of bucket `b` end up contiguous in
+// `items`, within [offset[b], offset[b + 1]), in the order `for_each(emit)` visits them. `for_each` is called twice,
+// and must call `emit(bucket, item)` for the same pairs, in the same order, both times -- once to count, once to fill.
+// `cursor` is scratch, passed in to reuse its capacity. Any vector type, e.g. `std::pmr::vector`, fits.
+template <typename Vector, typename ForEach>
+void FillBuckets(std::size_t n_buckets, const ForEach &for_each, Vector &offset, Vector &items, Vector &cursor) {
+    using Index = typename Vector::value_type;
+
+    // -- counted shifted by one, so that the prefix sum gives the offsets
+    offset.assign(n_buckets + 1, 0);
+    for_each([&](std::size_t bucket, Index /*item*/) { ++offset[bucket + 1]; });
+    for (std::size_t b = 0; b < n_buckets; ++b) offset[b + 1] += offset[b];
+
+    items.resize(offset[n_buckets]);
+    cursor.assign(offset.begin(), offset.end() - 1);
+    for_each([&](std::size_t bucket, Index item) { items[cursor[bucket]++] = item; });
+}
+
+}  // namespace T2DS
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "App/Logger.hxx"
+
+namespace T2DS::CrossCheck {
+
+// Fast paths that `--cross-check` compares against the exact path they replace, run next to them on the same input.
+enum class ECheck : std::uint8_t {
+    PairGrid,         // -- partners of every track, found through the grid vs by brute force
+    BatchSeeding,     // -- pairs rejected by the batched first phase of seeding vs by seeding them one by one
+    SeedingAccuracy,  // -- DCA and PCAs of the pairs near the cut, by the batched first phase of seeding vs one by one
+    FloatSeeding,     // -- pairs rejected by the batched first phase of seeding in float vs by seeding them one by one
+    // --
+    kNChecks,
+};
+inline constexpr std::array<const char *, static_cast<std::size_t>(ECheck::kNChecks)> Name_Check{"PairGrid", "BatchSeeding", "SeedingAccuracy",
+                                                                                                  "FloatSeeding"};
+
+// -- summed over all threads
+inline std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(ECheck::kNChecks)> gNCompared{};
+inline std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(ECheck::kNChecks)> gNMismatches{};
+
+// Count one comparison. Returns `agreed`, so that the caller can report the mismatch in its own terms.
+inline bool Record(ECheck check, bool agreed) {
+    gNCompared[static_cast<std::size_t>(check)].fetch_add(1, std::memory_order_relaxed);
+    if (!agreed) gNMismatches[static_cast<std::size_t>(check)].fetch_add(1, std::memory_order_relaxed);
+    return agreed;
+}
+
+// Print the comparisons of every check that ran. Returns false if any of them found a mismatch. Only at the end of
+// the job, see `PerThread.hxx`.
+inline bool Report() {
+    bool ok = true;
+    for (std::size_t i = 0; i < Name_Check.size(); ++i) {
+        const auto n_compared = gNCompared[i].load();
+        const auto n_mismatches = gNMismatches[i].load();
+        if (n_compared == 0) continue;
+        if (n_mismatches == 0) {
+            Logger::Info("CrossCheck", "{:<15} = {} comparisons, all agree", Name_Check[i], n_compared);
+        } else {
+            Logger::Error("CrossCheck", "{:<15} = {} comparisons, {} mismatches", Name_Check[i], n_compared, n_mismatches);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+}  // namespace T2DS::CrossCheck
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <TH1.h>
+
+namespace T2DS {
+
+// Cut-flow of a selection, whose bin `i + 1` counts the candidates that reached cut `i` of the enum `E`.
+// Within the combinatorial loops, candidates are counted into plain integers, and these are folded into the histogram
+// only once, at the end of the analysis -- the result is the very same as filling it one candidate at a time.
+// NOTE: like the histogram it stands for, it's written by one task at a time, as every species/channel owns its own.
+template <typename E, E NCuts>
+class CutFlow {
+   public:
+    static constexpr std::size_t kNCuts = static_cast<std::size_t>(NCuts);
+
+    CutFlow() = default;
+    explicit CutFlow(TH1D *hist) : fHist{hist} {}
+
+    void Count(E cut) { ++fCounts[static_cast<std::size_t>(cut)]; }
+    void Count(E cut, std::uint64_t n) { fCounts[static_cast<std::size_t>(cut)] += n; }
+
+    // Same bin contents, errors, entries and statistics as calling `TH1D::Fill(cut)` once per count.
+    void Fold() {
+        if (fHist == nullptr) return;
+
+        // NOTE: read before setting any bin, as `SetBinContent` resets them
+        std::array<double, TH1::kNstat> stats{};
+        fHist->GetStats(stats.data());
+        double entries = fHist->GetEntries();
+
+        for (std::size_t i = 0; i < kNCuts; ++i) {
+            if (fCounts[i] == 0) continue;
+            const auto count = static_cast<double>(fCounts[i]);
+            const auto x = static_cast<double>(i);  // -- as filled with `TH1D::Fill(static_cast<double>(cut))`
+            const int bin = static_cast<int>(i) + 1;
+
+            if (fHist->GetSumw2N() > 0) {
+                const double error = fHist->GetBinError(bin);
+                fHist->SetBinError(bin, std::sqrt(error * error + count));
+            }
+            fHist->SetBinContent(bin, fHist->GetBinContent(bin) + count);
+
+            stats[0] += count;          // -- sum of weights
+            stats[1] += count;          // -- sum of squared weights
+            stats[2] += count * x;      // -- sum of weights times x
+            stats[3] += count * x * x;  // -- sum of weights times x^2
+            entries += count;
+        }
+
+        fHist->PutStats(stats.data());
+        fHist->SetEntries(entries);
+        fCounts.fill(0);
+    }
+
+   private:
+    TH1D *fHist{nullptr};
+    std::array<std::uint64_t, kNCuts> fCounts{};
+};
+
+}  // namespace T2DS
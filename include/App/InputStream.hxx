@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "common/Framework_TeeTree.hpp"
+#include "common/Schema_Events.hpp"
+
+#include "App/AsyncWorker.hxx"
+
+namespace T2DS {
+
+// Reads the events of one input file at a time into a staging `Schema::Events`, which is then swapped into the
+// worker's own instance. With read-ahead enabled, the next entry is read by a background thread while the current one
+// is being processed, so that decompression and deserialisation overlap with the combinatorics instead of adding up.
+// With pre-open enabled, the next input file is opened -- and its first selected entry read -- by another background
+// thread while the current file is being processed, which hides the latency of opening files on a shared filesystem.
+// NOTE: swapping relies on the contract of `Framework::TeeTree::Reader`: it keeps the addresses of the members that
+//       `CreateModel_TeeTree` names -- the containers themselves, never pointers into their contents -- and fills them
+//       in place at every `Load`. Hence a reader stays bound to its staging instance as long as that instance doesn't
+//       move, which the slots below can't, and whatever buffers `std::swap` left in its members.
+class InputStream {
+   public:
+    // The reader's model differs between workers, so they provide how to bind a reader to a `Schema::Events`.
+    using ReaderFactory = std::function<std::unique_ptr<Framework::TeeTree::Reader>(Schema::Events &, std::string_view)>;
+
+    InputStream() = delete;
+    InputStream(const InputStream &) = delete;
+    InputStream(InputStream &&) = delete;
+    InputStream &operator=(const InputStream &) = delete;
+    InputStream &operator=(InputStream &&) = delete;
+    ~InputStream() = default;
+
+    InputStream(ReaderFactory make_reader, bool read_ahead, bool pre_open);
+
+    [[nodiscard]] bool Open(std::string_view path);
+    void PreOpen(std::string_view path, long long first_entry);
+    [[nodiscard]] unsigned long GetEntries();
+
+    void Load(long long entry_idx, Schema::Events &into);
+    void ReadAhead(long long entry_idx);
+
+   private:
+    // An open input file, with its own staging buffer. Neither copyable nor movable, so that `staging` keeps the address
+    // its reader is bound to.
+    struct Slot {
+        Slot() = default;
+        Slot(const Slot &) = delete;
+        Slot &operator=(const Slot &) = delete;
+
+        Schema::Events staging;
+        std::unique_ptr<Framework::TeeTree::Reader> reader;
+        std::optional<long long> read_ahead_entry;  // entry already read (or being read) into `staging`, if any
+    };
+
+    ReaderFactory fMakeReader;
+
+    // -- the active slot serves `Load`, the other one receives the pre-opened file
+    std::array<Slot, 2> fSlots;
+    std::size_t fActive{0};
+
+    std::optional<std::string> fPreOpenedPath;
+    std::string fPreOpenError;
+
+    // -- declared last, so that they're joined before the slots are destroyed; null if disabled
+    std::unique_ptr<AsyncWorker> fReadAheadThread;
+    std::unique_ptr<AsyncWorker> fPreOpenThread;
+};
+
+// -- `Load` exchanges the contents of a staging instance with the worker's, member by member, see the note above
+static_assert(std::is_nothrow_move_constructible_v<Schema::Events> && std::is_nothrow_move_assignable_v<Schema::Events>);
+
+}  // namespace T2DS
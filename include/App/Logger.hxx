@@ -1,31 +1,70 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <cstdio>
 #include <format>
-#include <print>
+#include <string>
 #include <string_view>
 #include <utility>
 
 namespace Logger {
 
+// Messages below the threshold return before any formatting, so that disabled diagnostics -- e.g. the debug prints of
+// the seeders and the KF -- cost one relaxed load per call, and can stay compiled into release builds.
+enum class ELevel : std::uint8_t { Debug, Info, Warning, Error, Off };
+inline constexpr std::array<const char *, 5> Name_Level{"debug", "info", "warning", "error", "off"};
+
+#if T2DS_DEBUG
+inline constexpr ELevel kDefaultLevel = ELevel::Debug;
+#else
+inline constexpr ELevel kDefaultLevel = ELevel::Info;
+#endif
+inline std::atomic<ELevel> gThreshold{kDefaultLevel};
+
+inline void SetLevel(ELevel level) { gThreshold.store(level, std::memory_order_relaxed); }
+[[nodiscard]] inline bool IsEnabled(ELevel level) { return level >= gThreshold.load(std::memory_order_relaxed); }
+
+// By default, lines are printed right away by the calling thread. Once the asynchronous sink is started, they are
+// pushed into a bounded ring buffer instead, and printed by a background thread -- callers only block when it's full.
+// The sink is drained and stopped by `StopAsync()`, or at exit.
+void StartAsync();
+void StopAsync();
+
+// Print an already formatted line into `stream`, through the asynchronous sink if started.
+void Write(std::FILE *stream, std::string &&line);
+
 template <typename... Args>
 inline void Debug(std::string_view func, std::format_string<Args...> fmt, Args &&...args) {
-    std::println(stdout, "DEBUG :: {} :: {}", func, std::format(fmt, std::forward<Args>(args)...));
+    if (!IsEnabled(ELevel::Debug)) return;
+    Write(stdout, std::format("DEBUG :: {} :: {}", func, std::format(fmt, std::forward<Args>(args)...)));
 }
 
 template <typename... Args>
 inline void Info(std::string_view func, std::format_string<Args...> fmt, Args &&...args) {
-    std::println(stdout, "INFO  :: {} :: {}", func, std::format(fmt, std::forward<Args>(args)...));
+    if (!IsEnabled(ELevel::Info)) return;
+    Write(stdout, std::format("INFO  :: {} :: {}", func, std::format(fmt, std::forward<Args>(args)...)));
 }
 
 template <typename... Args>
 inline void Warning(std::string_view func, std::format_string<Args...> fmt, Args &&...args) {
-    std::println(stderr, "WARN  :: {} :: {}", func, std::format(fmt, std::forward<Args>(args)...));
+    if (!IsEnabled(ELevel::Warning)) return;
+    Write(stderr, std::format("WARN  :: {} :: {}", func, std::format(fmt, std::forward<Args>(args)...)));
+}
+
+// Periodic reports on the progress of the job, kept off stdout.
+// NOTE: they were explicitly requested with `--progress`, thus only `off` silences them.
+template <typename... Args>
+inline void Status(std::string_view func, std::format_string<Args...> fmt, Args &&...args) {
+    if (!IsEnabled(ELevel::Error)) return;
+    Write(stderr, std::format("STAT  :: {} :: {}", func, std::format(fmt, std::forward<Args>(args)...)));
 }
 
 template <typename... Args>
 inline void Error(std::string_view func, std::format_string<Args...> fmt, Args &&...args) {
-    std::println(stderr, "ERROR :: {} :: {}", func, std::format(fmt, std::forward<Args>(args)...));
+    if (!IsEnabled(ELevel::Error)) return;
+    Write(stderr, std::format("ERROR :: {} :: {}", func, std::format(fmt, std::forward<Args>(args)...)));
 }
 
 }  // namespace Logger
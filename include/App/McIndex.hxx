@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "common/Constants.hpp"
+#include "common/POD_McParticle.hpp"
+
+#include "App/Buckets.hxx"
+
+namespace T2DS {
+
+// Ancestry of the MC particles of an event, built once per event after loading it: the children of every particle are
+// stored contiguously, in compressed-sparse-row form, and next to them its decay vertex -- so that navigating the decay
+// chains doesn't need to scan the whole of `McParticle` every time.
+// NOTE: only valid as long as the particles given to `Build` aren't modified.
+class McIndex {
+   public:
+    using Entry = std::uint32_t;  // entry of the particle in the input
+
+    void Build(std::span<const POD::McParticle> particles) {
+        fParticles = particles;
+        const std::size_t n = particles.size();
+
+        // -- the children of every mother, in order of entry, as a scan over the input would find them
+        FillBuckets(
+            n,
+            [&](const auto &emit) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (HasMother(particles[i], n)) emit(static_cast<std::size_t>(particles[i].Mother_McEntry), static_cast<Entry>(i));
+                }
+            },
+            fOffset, fChildren, fCursor);
+
+        // -- decay vertex, i.e. the origin of the first child
+        fDecayVertex.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (fOffset[i] == fOffset[i + 1]) {
+                fDecayVertex[i] = {Common::DummyFloat, Common::DummyFloat, Common::DummyFloat};
+                continue;
+            }
+            const auto &child = particles[fChildren[fOffset[i]]];
+            fDecayVertex[i] = {child.Origin_X, child.Origin_Y, child.Origin_Z};
+        }
+    }
+
+    void Clear() {
+        fParticles = {};
+        fOffset.clear();
+        fChildren.clear();
+        fDecayVertex.clear();
+    }
+
+    [[nodiscard]] std::span<const Entry> Children(std::size_t mc_entry) const {
+        return std::span<const Entry>(fChildren).subspan(fOffset[mc_entry], fOffset[mc_entry + 1] - fOffset[mc_entry]);
+    }
+
+    // Entry of the first child with the given pdg code, if any.
+    [[nodiscard]] std::optional<std::size_t> FindDaughter(std::size_t mc_entry, int pdg_code) const {
+        for (const Entry child : Children(mc_entry)) {
+            if (fParticles[child].PdgCode == pdg_code) return child;
+        }
+        return std::nullopt;
+    }
+
+    // Dummy coordinates if the particle didn't decay.
+    [[nodiscard]] std::tuple<float, float, float> DecayVertex(std::size_t mc_entry) const { return fDecayVertex[mc_entry]; }
+
+   private:
+    static bool HasMother(const POD::McParticle &mc, std::size_t n) {
+        return mc.Mother_McEntry > Common::DummyInt && static_cast<std::size_t>(mc.Mother_McEntry) < n;
+    }
+
+    std::span<const POD::McParticle> fParticles;
+    std::vector<Entry> fOffset;  // -- children of entry `i` are within [fOffset[i], fOffset[i + 1])
+    std::vector<Entry> fChildren;
+    std::vector<Entry> fCursor;  // -- scratch, kept to reuse its capacity
+    std::vector<std::tuple<float, float, float>> fDecayVertex;
+};
+
+}  // namespace T2DS
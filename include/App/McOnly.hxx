@@ -0,0 +1,18 @@
+#pragma once
+
+#include <memory_resource>
+#include <type_traits>
+
+namespace T2DS {
+
+// Stands for a member that only the MC build of a worker carries. Declared `[[no_unique_address]]`, it takes no storage.
+struct NoMc {
+    NoMc() = default;
+    explicit NoMc(std::pmr::memory_resource * /*memory*/) {}  // -- as the arena-backed members it stands for
+};
+
+// Type of a member that only exists in the MC build, e.g. `McOnly<IsMC, std::vector<POD::Extended::McParticle>>`.
+template <bool IsMC, typename T>
+using McOnly = std::conditional_t<IsMC, T, NoMc>;
+
+}  // namespace T2DS
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "App/Settings.hxx"
+
+namespace T2DS::Metrics {
+
+// What a cut step is selecting. Candidate counts per channel are the pairs leaving its `PostFitCuts` step.
+enum class ESelection : std::uint8_t {
+    // finder
+    AntiLambda,
+    Lambda,
+    KaonZeroShort,
+    ChannelA,
+    ChannelA_Bkg,
+    ChannelD,
+    ChannelD_Bkg,
+    ChannelH,
+    ChannelH_Bkg,
+    // verifier -- seed cuts on the pre-found (anti)lambdas come before any hypothesis, fit cuts reuse the finder's
+    PreFoundLambda,
+    AntiHdibaryon,
+    Hdibaryon,
+    MixedLambdaPair,
+    // --
+    kNSelections,
+};
+inline constexpr std::array<const char *, static_cast<std::size_t>(ESelection::kNSelections)> Name_Selection{
+    "AntiLambda", "Lambda", "KaonZeroShort", "ChannelA", "ChannelA_Bkg", "ChannelD", "ChannelD_Bkg",
+    "ChannelH", "ChannelH_Bkg", "PreFoundLambda", "AntiHdibaryon", "Hdibaryon", "MixedLambdaPair",
+};
+
+enum class EStep : std::uint8_t {
+    PostSeedCuts,
+    PostFitCuts,
+    // --
+    kNSteps,
+};
+inline constexpr std::array<const char *, static_cast<std::size_t>(EStep::kNSteps)> Name_Step{"PostSeedCuts", "PostFitCuts"};
+
+// Runtime switch, set once by `--metrics` before any event is processed.
+inline std::atomic<bool> gEnabled{false};
+
+void Enable(std::size_t n_input_files);
+[[nodiscard]] inline bool IsEnabled() { return gEnabled.load(std::memory_order_relaxed); }
+
+void RecordCut(ESelection selection, EStep step, bool passed);
+void RecordCuts(ESelection selection, EStep step, std::uint64_t n_in, std::uint64_t n_passed);
+
+// Count one pair going through a cut step. Returns `passed`, so that it can wrap the call to the cuts.
+inline bool CountCut(ESelection selection, EStep step, bool passed) {
+    if (IsEnabled()) RecordCut(selection, step, passed);
+    return passed;
+}
+
+// Count `n` pairs as rejected by a cut step at once, e.g. those that were never paired as they couldn't pass it.
+inline void CountRejected(ESelection selection, EStep step, std::uint64_t n) {
+    if (IsEnabled() && n > 0) RecordCuts(selection, step, n, 0);
+}
+
+// Count the events processed from input file `file_idx`. Thread-safe, meant to be called once per file or work unit.
+void CountEvents(std::size_t file_idx, unsigned long n_events);
+
+// Write every metric into `settings.PathMetricsFile`, as JSON. Only at the end of the job, see `PerThread.hxx`.
+bool Write(const Settings &settings, std::chrono::duration<double> wall_time);
+
+}  // namespace T2DS::Metrics
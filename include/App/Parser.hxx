@@ -30,6 +30,7 @@ class Parser {
     void AddOptions();
 
     static constexpr std::array<double, 5> AllowedMasses{1.73, 1.8, 1.87, 1.94, 2.01};
+    static constexpr unsigned int DefaultProgressInterval = 60;  // seconds, when only `--heartbeat` is given
 
     CLI::App CLI_APP;
     std::vector<std::string> InputFiles;
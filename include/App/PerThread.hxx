@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace T2DS {
+
+// One `T` per thread that touches it, for statistics that are updated far too often to share a lock or an atomic.
+// Each thread writes into its own instance without any synchronization. Instances are owned by the registry, thus
+// they outlive their threads, and `ForEach` may read them once every thread is idle -- typically at the end of the job.
+// NOTE: the same holds for every end-of-job report, whether it reads a `PerThread` or relaxed atomics, see `Finish` in
+// `App.cxx`.
+// NOTE: the thread-local lookup is per `T`, so there must be a single `PerThread<T>` for any given `T`.
+template <typename T>
+class PerThread {
+   public:
+    T &Local() {
+        thread_local T *local = Register();
+        return *local;
+    }
+
+    template <typename F>
+    void ForEach(const F &visit) {
+        std::lock_guard lock(fMutex);
+        for (const auto &instance : fInstances) visit(static_cast<const T &>(*instance));
+    }
+
+   private:
+    T *Register() {
+        std::lock_guard lock(fMutex);
+        fInstances.push_back(std::make_unique<T>());
+        return fInstances.back().get();
+    }
+
+    std::mutex fMutex;
+    std::vector<std::unique_ptr<T>> fInstances;
+};
+
+}  // namespace T2DS
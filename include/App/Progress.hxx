@@ -0,0 +1,30 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "App/Settings.hxx"
+
+namespace T2DS::Progress {
+
+// Live progress of the job, reported by a background thread every `--progress` seconds: events done out of the total,
+// instantaneous and average events/s, ETA and current file. Reports go to stderr and, with `--heartbeat`, replace the
+// contents of a small key=value file that can be polled from outside, e.g. by the Slurm scripts.
+// NOTE: without `-n`, the total is extrapolated from the files opened so far, until every file has been opened.
+
+inline std::atomic<std::uint64_t> gEventsDone{0};
+
+// Start the reporting thread, if requested. No-op otherwise.
+void Start(const Settings &settings);
+// Stop the reporting thread, after a final report.
+void Stop();
+
+// Input file `file_idx` was opened, and `n_events` of its entries are going to be read.
+void OpenedFile(std::size_t file_idx, unsigned long n_events);
+// The exact total is known in advance, e.g. after planning the work units of the event-parallel mode.
+void SetTotal(std::uint64_t n_events);
+
+inline void EventDone() { gEventsDone.fetch_add(1, std::memory_order_relaxed); }
+
+}  // namespace T2DS::Progress
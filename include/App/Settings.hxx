@@ -6,17 +6,42 @@
 #include <string>
 #include <vector>
 
+#include "App/Logger.hxx"
+
 namespace T2DS {
 
 enum EProgramMode : std::uint8_t { FINDER, VERIFIER };
 inline constexpr std::array<const char *, 2> Name_ProgramMode{"FINDER", "VERIFIER"};
 
+// Precision of the batched first phase of seeding, the one that rejects most pairs.
+enum class ESeedingPrecision : std::uint8_t { Double, Float };
+inline constexpr std::array<const char *, 2> Name_SeedingPrecision{"double", "float"};
+
 struct Settings {
     void Print() const;
 
     std::string PathOutputFile;
     std::vector<std::string> PathInputFiles;
     std::optional<unsigned long> LimitToNEvents;
+    std::optional<unsigned long> FirstEvent;  // global entry numbers, counted across all input files
+    std::optional<unsigned long> LastEvent;   // inclusive
+    unsigned int ShardIndex{0};
+    unsigned int NShards{1};
+    unsigned int NThreads{1};
+    unsigned int NTasks{1};
+    bool ReadAhead{false};
+    bool PreOpen{false};
+    bool Pipeline{false};
+    bool PairGrid{false};
+    ESeedingPrecision SeedingPrecision{ESeedingPrecision::Double};
+    bool CrossCheck{false};
+    bool Timers{false};
+    bool ArenaReport{false};
+    std::string PathMetricsFile;
+    unsigned int ProgressInterval{0};  // seconds, 0 if disabled
+    std::string PathHeartbeatFile;
+    Logger::ELevel LogLevel{Logger::kDefaultLevel};
+    bool AsyncLog{false};
     double SexaquarkMass{};
     EProgramMode Mode{EProgramMode::FINDER};
     bool IsMC{false};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace T2DS {
+
+inline constexpr std::size_t kCacheLineSize = 64;
+
+// Bounded lock-free queue between exactly one producer thread and one consumer thread.
+// `Push` blocks while the queue is full and `Pop` blocks while it's empty; both sleep on the index they wait for
+// (`std::atomic::wait`) instead of spinning, so an idle stage doesn't burn a core.
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+   public:
+    void Push(T value) {
+        const std::size_t tail = fTail.load(std::memory_order_relaxed);
+        std::size_t head = fHead.load(std::memory_order_acquire);
+        while (tail - head == Capacity) {
+            fHead.wait(head, std::memory_order_acquire);
+            head = fHead.load(std::memory_order_acquire);
+        }
+        fBuffer[tail & (Capacity - 1)] = std::move(value);
+        fTail.store(tail + 1, std::memory_order_release);
+        fTail.notify_one();
+    }
+
+    T Pop() {
+        const std::size_t head = fHead.load(std::memory_order_relaxed);
+        std::size_t tail = fTail.load(std::memory_order_acquire);
+        while (tail == head) {
+            fTail.wait(tail, std::memory_order_acquire);
+            tail = fTail.load(std::memory_order_acquire);
+        }
+        T value = std::move(fBuffer[head & (Capacity - 1)]);
+        fHead.store(head + 1, std::memory_order_release);
+        fHead.notify_one();
+        return value;
+    }
+
+   private:
+    // -- producer and consumer indices on separate cache lines, so they don't invalidate each other
+    alignas(kCacheLineSize) std::atomic<std::size_t> fHead{0};  // written by the consumer
+    alignas(kCacheLineSize) std::atomic<std::size_t> fTail{0};  // written by the producer
+    std::array<T, Capacity> fBuffer{};
+};
+
+}  // namespace T2DS
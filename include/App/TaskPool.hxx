@@ -0,0 +1,165 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace T2DS {
+
+// Fixed set of threads running short, independent tasks -- such as the combinatorics of a single species or channel
+// within one event. Every thread owns a queue: it takes its own tasks from the back, and when that's empty it steals
+// from the front of the others', so a long task doesn't leave the rest of the event waiting on one core.
+// Tasks are submitted and awaited through a `TaskGroup`.
+class TaskPool {
+   public:
+    using Task = std::function<void()>;
+
+    TaskPool() = delete;
+    TaskPool(const TaskPool &) = delete;
+    TaskPool(TaskPool &&) = delete;
+    TaskPool &operator=(const TaskPool &) = delete;
+    TaskPool &operator=(TaskPool &&) = delete;
+
+    explicit TaskPool(unsigned int n_threads) : fQueues(n_threads) {
+        for (auto &queue : fQueues) queue = std::make_unique<Queue>();
+        for (std::size_t id_thread = 0; id_thread < n_threads; ++id_thread) fThreads.emplace_back([this, id_thread] { Loop(id_thread); });
+    }
+
+    // pending tasks are dropped, but every `TaskGroup` is expected to have been waited for already
+    ~TaskPool() {
+        fStopping.store(true, std::memory_order_release);
+        fQueued.fetch_add(1, std::memory_order_release);  // wake up every idle thread
+        fQueued.notify_all();
+        fThreads.clear();
+    }
+
+    [[nodiscard]] std::size_t NumberThreads() const { return fQueues.size(); }
+
+    // Tasks from outside the pool are spread round-robin over the queues.
+    void Submit(Task task) {
+        const std::size_t id_queue = fNextQueue.fetch_add(1, std::memory_order_relaxed) % fQueues.size();
+        fQueued.fetch_add(1, std::memory_order_release);  // counted before being visible, so that it never goes below zero
+        {
+            std::lock_guard lock(fQueues[id_queue]->mutex);
+            fQueues[id_queue]->tasks.push_back(std::move(task));
+        }
+        fQueued.notify_one();
+    }
+
+    // Run one pending task, if any -- the own queue of `id_thread` first, then stealing from the others.
+    // Returns false if every queue was empty.
+    bool RunPendingTask(std::optional<std::size_t> id_thread = std::nullopt) {
+        auto task = id_thread.has_value() ? PopBack(*id_thread) : std::nullopt;
+        const std::size_t first = id_thread.value_or(0);
+        for (std::size_t offset = 1; !task.has_value() && offset <= fQueues.size(); ++offset) {
+            task = StealFront((first + offset) % fQueues.size());
+        }
+        if (!task.has_value()) return false;
+        fQueued.fetch_sub(1, std::memory_order_relaxed);
+        (*task)();
+        return true;
+    }
+
+   private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::optional<Task> PopBack(std::size_t id_queue) {
+        std::lock_guard lock(fQueues[id_queue]->mutex);
+        auto &tasks = fQueues[id_queue]->tasks;
+        if (tasks.empty()) return std::nullopt;
+        Task task = std::move(tasks.back());
+        tasks.pop_back();
+        return task;
+    }
+
+    std::optional<Task> StealFront(std::size_t id_queue) {
+        std::lock_guard lock(fQueues[id_queue]->mutex);
+        auto &tasks = fQueues[id_queue]->tasks;
+        if (tasks.empty()) return std::nullopt;
+        Task task = std::move(tasks.front());
+        tasks.pop_front();
+        return task;
+    }
+
+    void Loop(std::size_t id_thread) {
+        while (!fStopping.load(std::memory_order_acquire)) {
+            if (RunPendingTask(id_thread)) continue;
+            // sleep until something is queued -- a task may be stolen before we get to it, then we just sleep again
+            fQueued.wait(0, std::memory_order_acquire);
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> fQueues;
+    std::atomic<std::size_t> fNextQueue{0};
+    std::atomic<std::size_t> fQueued{0};  // number of tasks sitting in any queue
+    std::atomic<bool> fStopping{false};
+
+    std::vector<std::jthread> fThreads;  // last: joined before any other member is destroyed
+};
+
+// Set of tasks that are awaited together. `Wait` doesn't block idly: the waiting thread runs pending tasks -- its own
+// or anyone else's -- and only sleeps once none is left to run, until the last task of the group has finished.
+// Without a pool, `Run` simply runs each task on the spot, so callers don't need a separate sequential path.
+class TaskGroup {
+   public:
+    TaskGroup() = delete;
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup(TaskGroup &&) = delete;
+    TaskGroup &operator=(const TaskGroup &) = delete;
+    TaskGroup &operator=(TaskGroup &&) = delete;
+
+    explicit TaskGroup(TaskPool *pool) : fPool{pool}, fPending{pool != nullptr ? std::make_shared<std::atomic<std::size_t>>(0) : nullptr} {}
+    ~TaskGroup() { WaitForPending(); }  // tasks refer to the group, so they can't outlive it
+
+    template <typename F>
+    void Run(F &&task) {
+        if (fPool == nullptr) {
+            task();
+            return;
+        }
+        fPending->fetch_add(1, std::memory_order_relaxed);
+        fPool->Submit([this, pending = fPending, task = std::forward<F>(task)]() mutable {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard lock(fErrorMutex);
+                if (!fError) fError = std::current_exception();
+            }
+            // -- the group may be gone as soon as the count drops to zero, hence the tasks share ownership of the counter
+            if (pending->fetch_sub(1, std::memory_order_acq_rel) == 1) pending->notify_all();
+        });
+    }
+
+    // If any task threw, the first exception is rethrown here.
+    void Wait() {
+        WaitForPending();
+        if (fError) std::rethrow_exception(std::exchange(fError, nullptr));
+    }
+
+   private:
+    void WaitForPending() {
+        if (fPending == nullptr) return;
+        for (std::size_t pending = fPending->load(std::memory_order_acquire); pending != 0; pending = fPending->load(std::memory_order_acquire)) {
+            // -- nothing left to run, the remaining tasks are running elsewhere: sleep until the last one finishes
+            if (!fPool->RunPendingTask()) fPending->wait(pending, std::memory_order_acquire);
+        }
+    }
+
+    TaskPool *fPool;
+    std::shared_ptr<std::atomic<std::size_t>> fPending;  // -- tasks not finished yet, only with a pool
+    std::mutex fErrorMutex;
+    std::exception_ptr fError;
+};
+
+}  // namespace T2DS
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+namespace T2DS::Timers {
+
+// Timed sections. Timers nest -- `FitVertex` is also counted inside the stage that calls it -- so totals are inclusive.
+enum class ETimer : std::uint8_t {
+    // finder
+    ProcessTracks,
+    FindV0s_AntiLambda,
+    FindV0s_Lambda,
+    FindV0s_KaonZeroShort,
+    FindV0s_SharedPairs,
+    SeedV0s_Batch,
+    ChannelA,
+    ChannelA_Bkg,
+    ChannelD,
+    ChannelD_Bkg,
+    ChannelH,
+    ChannelH_Bkg,
+    // verifier
+    ProcessPreFoundLambda,
+    VerifyLambdaPair,
+    // shared
+    FitVertex,
+    WriterFill,
+    // --
+    kNTimers,
+};
+inline constexpr std::array<const char *, static_cast<std::size_t>(ETimer::kNTimers)> Name_Timer{
+    "ProcessTracks", "FindV0s_AntiLambda", "FindV0s_Lambda", "FindV0s_KaonZeroShort", "FindV0s_SharedPairs", "SeedV0s_Batch", "ChannelA",
+    "ChannelA_Bkg", "ChannelD", "ChannelD_Bkg", "ChannelH", "ChannelH_Bkg", "ProcessPreFoundLambda", "VerifyLambdaPair", "FitVertex",
+    "WriterFill",
+};
+
+// Timers of single calls within the pair loops, rather than of a stage of the event: hit millions of times per job.
+[[nodiscard]] constexpr bool IsPerCall(ETimer timer) { return timer == ETimer::SeedV0s_Batch || timer == ETimer::FitVertex; }
+
+// What is timed: nothing, only the stages in wall time -- enough for `--metrics` -- or, with `--timers`, also every
+// per-call timer and the CPU time of the calling thread.
+enum class ELevel : std::uint8_t { Off, Stages, All };
+
+// Runtime switch, set once by `--timers` or `--metrics` before any event is processed.
+inline std::atomic<ELevel> gLevel{ELevel::Off};
+
+inline void Enable(ELevel level) { gLevel.store(level, std::memory_order_relaxed); }
+[[nodiscard]] inline ELevel Level() { return gLevel.load(std::memory_order_relaxed); }
+
+// CPU time consumed so far by the calling thread.
+[[nodiscard]] inline std::chrono::nanoseconds ThreadCpuTime() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+}
+
+// Add one measurement to the statistics of the calling thread.
+void Record(ETimer timer, std::chrono::nanoseconds wall, std::chrono::nanoseconds cpu);
+
+// Statistics of one timer, summed over all threads.
+struct Summary {
+    const char *name{nullptr};
+    std::uint64_t calls{0};
+    double wall_s{0.};
+    double cpu_s{0.};
+    double mean_us{0.};
+    double p50_us{0.};
+    double p90_us{0.};
+    double p99_us{0.};
+    double max_us{0.};
+};
+
+// One entry per timer that was hit at least once. Only at the end of the job, see `PerThread.hxx`.
+[[nodiscard]] std::vector<Summary> Summarize();
+
+// Print the summaries as a table.
+void Report();
+
+// Measures its own lifetime, in wall time, and in CPU time at `ELevel::All`. When it isn't enabled at the current level,
+// it costs a relaxed load and a branch.
+class Scoped {
+   public:
+    Scoped() = delete;
+    Scoped(const Scoped &) = delete;
+    Scoped(Scoped &&) = delete;
+    Scoped &operator=(const Scoped &) = delete;
+    Scoped &operator=(Scoped &&) = delete;
+
+    explicit Scoped(ETimer timer) : fTimer{timer} {
+        const ELevel level = Level();
+        fEnabled = level == ELevel::All || (level == ELevel::Stages && !IsPerCall(timer));
+        if (!fEnabled) return;
+        fWithCpu = level == ELevel::All;
+        if (fWithCpu) fStartCpu = ThreadCpuTime();
+        fStart = std::chrono::steady_clock::now();
+    }
+    ~Scoped() {
+        if (!fEnabled) return;
+        const auto wall = std::chrono::steady_clock::now() - fStart;
+        Record(fTimer, wall, fWithCpu ? ThreadCpuTime() - fStartCpu : std::chrono::nanoseconds{0});
+    }
+
+   private:
+    ETimer fTimer;
+    bool fEnabled{false};
+    bool fWithCpu{false};
+    std::chrono::steady_clock::time_point fStart{};
+    std::chrono::nanoseconds fStartCpu{};
+};
+
+}  // namespace T2DS::Timers
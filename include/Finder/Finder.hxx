@@ -1,8 +1,10 @@
 #pragma once
 
-#include <exception>
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -20,9 +22,20 @@
 #include "common/Schema_Events.hpp"
 #include "common/Schema_FoundSexaquark.hpp"
 
+#include "App/Arena.hxx"
+#include "App/CrossCheck.hxx"
+#include "App/CutFlow.hxx"
+#include "App/InputStream.hxx"
 #include "App/Logger.hxx"
+#include "App/McOnly.hxx"
+#include "App/Metrics.hxx"
 #include "App/Settings.hxx"
+#include "App/TaskPool.hxx"
+#include "Finder/McTrackMemo.hxx"
 #include "KalmanFitter/BaseKalmanFitter.hxx"
+#include "Seeder/PairCache.hxx"
+#include "Seeder/PairGrid.hxx"
+#include "Seeder/TrackStore.hxx"
 
 // forward declarations //
 // clang-format off
@@ -35,6 +48,8 @@ namespace Seeder{ struct PCA; }
 
 // Collect secondary charged kaons and reconstruct V0s, then combine them into antisexaquark candidates.
 // The secondaries are built once per event and shared by every requested reaction channel.
+// Built for either data or MC, chosen once in `main`: the data build carries none of the MC branches nor storage.
+template <bool IsMC>
 class Finder {
     // PENDING for author: missing cuts enums+structs + duplications treatments
 
@@ -90,10 +105,27 @@ class Finder {
         // PENDING
         kNChannelHCuts,
     };
-    template <typename E>
-    static void FillHist(TH1D *hist, const E &bin_n) {
-        hist->Fill(static_cast<double>(bin_n));
+    using CutFlow_Proton = CutFlow<EProton, EProton::kNProtonCuts>;
+    using CutFlow_Kaon = CutFlow<EKaon, EKaon::kNKaonCuts>;
+    using CutFlow_Pion = CutFlow<EPion, EPion::kNPionCuts>;
+    using CutFlow_Lambda = CutFlow<ELambda, ELambda::kNLambdaCuts>;
+    using CutFlow_KaonZeroShort = CutFlow<EKaonZeroShort, EKaonZeroShort::kNKaonZeroShortCuts>;
+    using CutFlow_ChannelA = CutFlow<EChannelA, EChannelA::kNChannelACuts>;
+    using CutFlow_ChannelD = CutFlow<EChannelD, EChannelD::kNChannelDCuts>;
+    using CutFlow_ChannelH = CutFlow<EChannelH, EChannelH::kNChannelHCuts>;
+    template <typename E, E NCuts>
+    static void FillHist(CutFlow<E, NCuts> *cut_flow, E cut) {
+        cut_flow->Count(cut);
     }
+    template <typename E, E NCuts>
+    static void FillHist(CutFlow<E, NCuts> *cut_flow, E cut, std::uint64_t n) {
+        cut_flow->Count(cut, n);
+    }
+
+    // MC-related //
+
+    template <typename T>
+    using Mc = McOnly<IsMC, T>;
 
     // Injected-related //
 
@@ -119,68 +151,187 @@ class Finder {
     explicit Finder(const Settings &settings)
         : fSettings{settings},
           // input
-          fInput{},
-          fReader{nullptr},
+          fEvent{},
+          fInputStream{[this](Schema::Events &staging, std::string_view path) {
+                           return std::make_unique<Framework::TeeTree::Reader>(staging.CreateModel_TeeTree(IsMC, IsMC),
+                                                                               E2T::Name_OutputTree, path);
+                       },
+                       fSettings.ReadAhead, fSettings.PreOpen},
+          // tasks -- the thread waiting for them works too, hence one less
+          fTaskPool{fSettings.NTasks > 1 ? std::make_unique<TaskPool>(fSettings.NTasks - 1) : nullptr},
           // output
           fOutput_File{std::make_unique<TFile>(fSettings.PathOutputFile.c_str(), "RECREATE")},
           fOutput{},
-          fWriter{std::make_unique<Framework::Writer>(fOutput.CreateModel(fSettings.IsMC), T2DS::Name_FoundSexaquarkRNT, *fOutput_File)} {
+          fWriter{std::make_unique<Framework::Writer>(fOutput.CreateModel(IsMC), T2DS::Name_FoundSexaquarkRNT, *fOutput_File)} {
 
         PrepareOutputHistograms();
 
         Logger::Info(__FUNCTION__, "Finder initialized successfully.");
     }
 
-    [[nodiscard]] bool OpenInput(std::string_view path) {
-        fReader.reset();  // raw `TTree*` must die first
-        try {
-            fReader =
-                std::make_unique<Framework::TeeTree::Reader>(fInput.CreateModel_TeeTree(fSettings.IsMC, fSettings.IsMC), E2T::Name_OutputTree, path);
-        } catch (const std::exception &exc) {
-            Logger::Error(__FUNCTION__, "Couldn't read {} ({}) -- skipping it.", path, exc.what());
-            return false;
-        }
-        return true;
-    }
-
-    void Load(long long entry_idx) { fReader->Load(entry_idx); }
-    [[nodiscard]] unsigned long NumberEventsToRead() { return static_cast<unsigned long>(fReader->GetEntries()); }
+    // As PID is non-exclusive, a track can pass as several species, e.g. as a pion and as a kaon. Then, the same
+    // (neg, pos) pair can be a candidate of several V0 hypotheses -- e.g. a pion pair is a K0S candidate, and a Lambda
+    // one too if the positive pion also passes as a proton.
+    enum ESpecies : std::uint8_t {
+        kAntiProton = 1 << 0,
+        kProton = 1 << 1,
+        kNegKaon = 1 << 2,
+        kPosKaon = 1 << 3,
+        kPiMinus = 1 << 4,
+        kPiPlus = 1 << 5,
+    };
+    // Tracks are referred to by their entry in `Input.Track`, and only copied when a candidate is stored.
+    using TrackIdx = Seeder::TrackStore::Entry;
+    struct SharedV0Pair {
+        std::uint32_t row_neg;  // -- row in `Tracks`
+        std::uint32_t row_pos;  // -- row in `Tracks`
+        std::uint32_t slot;     // -- slot in `SharedV0Pairs`
+    };
 
-    void ProcessEvent();
-    void ProcessInjected();
-    void ProcessTracks();
+    // Everything a single event touches between `Load` and `EndOfEvent`. The sequential engine works on a single one
+    // (`fEvent`), while the pipelined engine keeps several of them in flight, one per stage.
+    struct EventState {
+        void Clear();
+
+        // input //
+
+        Schema::Events Input;
+        // -- cached
+        ROOT::Math::XYZPoint PrimaryVertex;
+        double MagneticField{0.};
+
+        // temporary in-memory data //
+
+        // -- backs the transient containers below, thus declared before them, and released in `Clear()`
+        Arena Memory;
+
+        // Every selected track is stored once, whichever species it passes as, keeping its kinematics as
+        // structures-of-arrays for the pair loops to stream through. Species are the rows of the tracks that pass as such.
+        Seeder::TrackStore Tracks;  // -- selections are bitmasks of `ESpecies`
+        Seeder::TrackView AntiProton{&Memory};
+        Seeder::TrackView Proton{&Memory};
+        Seeder::TrackView NegKaon{&Memory};
+        Seeder::TrackView PosKaon{&Memory};
+        Seeder::TrackView PiMinus{&Memory};
+        Seeder::TrackView PiPlus{&Memory};
+
+        // -- mc truth of the tracks, only classified once they're part of a stored candidate, see `McTrack(...)`
+        [[no_unique_address]] Mc<McTrackMemo> MC_Tracks;
+
+        // -- (neg, pos) pairs that more than one V0 hypothesis takes part in, seeded once for all of them
+        Seeder::PairCache SharedV0Pairs;
+        std::pmr::vector<SharedV0Pair> PendingV0Pairs{&Memory};
+
+        std::pmr::vector<POD::V0> AntiLambda{&Memory};
+        std::pmr::vector<TrackIdx> AntiLambda_Neg{&Memory};
+        std::pmr::vector<TrackIdx> AntiLambda_Pos{&Memory};
+        std::pmr::vector<POD::V0> Lambda{&Memory};
+        std::pmr::vector<TrackIdx> Lambda_Neg{&Memory};
+        std::pmr::vector<TrackIdx> Lambda_Pos{&Memory};
+        std::pmr::vector<POD::V0> KaonZeroShort{&Memory};
+        std::pmr::vector<TrackIdx> KaonZeroShort_Neg{&Memory};
+        std::pmr::vector<TrackIdx> KaonZeroShort_Pos{&Memory};
+
+        [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> MC_AntiLambda{&Memory};
+        [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> MC_AntiLambda_Neg{&Memory};
+        [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> MC_AntiLambda_Pos{&Memory};
+        [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> MC_Lambda{&Memory};
+        [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> MC_Lambda_Neg{&Memory};
+        [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> MC_Lambda_Pos{&Memory};
+        [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> MC_KaonZeroShort{&Memory};
+        [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> MC_KaonZeroShort_Neg{&Memory};
+        [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> MC_KaonZeroShort_Pos{&Memory};
+
+        // output //
+
+        Schema::FoundSexaquark Output;  // swapped into the writer-bound `fOutput` when the event is kept
+        // -- background passes write apart, as they share columns with the signal passes they may run alongside
+        Schema::FoundSexaquark Output_Bkg;
+    };
 
-    void FindV0s() {
-        FindV0s(DB::Particles::Particle("AntiLambda"));
-        FindV0s(DB::Particles::Particle("Lambda"));
-        FindV0s(DB::Particles::Particle("KaonZeroShort"));
+    [[nodiscard]] bool OpenInput(std::string_view path) { return fInputStream.Open(path); }
+    void PreOpenInput(std::string_view path, long long first_entry) { fInputStream.PreOpen(path, first_entry); }
+    void Load(long long entry_idx) { Load(entry_idx, fEvent); }
+    void Load(long long entry_idx, EventState &ev) { fInputStream.Load(entry_idx, ev.Input); }
+    void ReadAhead(long long entry_idx) { fInputStream.ReadAhead(entry_idx); }
+    [[nodiscard]] unsigned long NumberEventsToRead() { return fInputStream.GetEntries(); }
+
+    // -- sequential engine: every step works on `fEvent`
+    void ProcessEvent() { ProcessEvent(fEvent); }
+    void ProcessInjected()
+        requires IsMC
+    {
+        ProcessInjected(fEvent);
     }
+    void ProcessTracks() { ProcessTracks(fEvent); }
+    void FindV0s() { FindV0s(fEvent); }
+    void FindSexaquarks() { FindSexaquarks(fEvent); }
+    void EndOfEvent() { EndOfEvent(fEvent); }
 
-    void FindSexaquarks() {
-        FindSexaquarks_ChannelA(false);
-        FindSexaquarks_ChannelA(true);
-        FindSexaquarks_ChannelD(false);
-        FindSexaquarks_ChannelD(true);
-        FindSexaquarks_ChannelH(false);
-        FindSexaquarks_ChannelH(true);
-    }
+    // -- pipelined engine: each step may work on a different event
+    void ProcessEvent(EventState &ev);
+    void ProcessInjected(EventState &ev)
+        requires IsMC;
+    void ProcessTracks(EventState &ev);
 
-    void EndOfEvent();
+    void FindV0s(EventState &ev);
+    void FindSexaquarks(EventState &ev);
+
+    void EndOfEvent(EventState &ev);
     bool EndOfAnalysis();
 
    private:
     void PrepareOutputHistograms();
 
+    [[nodiscard]] bool PreSeedCuts(const Seeder::TrackStore &tracks, Seeder::TrackView::Row row_neg, Seeder::TrackView::Row row_pos,
+                                   const DB::Particles::Definition &pid) {
+        switch (pid.pdg_code) {
+            case DB::Particles::Particle("AntiLambda").pdg_code: {
+                return PreSeedCuts_Lambda(tracks, row_neg, row_pos, &fCutFlow_AntiLambda);
+            }
+            case DB::Particles::Particle("Lambda").pdg_code: {
+                return PreSeedCuts_Lambda(tracks, row_neg, row_pos, &fCutFlow_Lambda);
+            }
+            case DB::Particles::Particle("KaonZeroShort").pdg_code: {
+                return PreSeedCuts_KaonZeroShort(tracks, row_neg, row_pos, &fCutFlow_KaonZeroShort);
+            }
+            default:
+                return false;
+        }
+    }
+
+    // Count `n` pairs rejected in bulk -- by `Seeder::PairGrid`, or the batched seeding -- as if each had failed the
+    // post-seed cuts, which they would have.
+    void CountRejectedInBulk(const DB::Particles::Definition &pid, Metrics::ESelection selection, std::uint64_t n) {
+        Metrics::CountRejected(selection, Metrics::EStep::PostSeedCuts, n);
+        switch (pid.pdg_code) {
+            case DB::Particles::Particle("AntiLambda").pdg_code: {
+                FillHist(&fCutFlow_AntiLambda, ELambda::kAllCombinations, n);
+                break;
+            }
+            case DB::Particles::Particle("Lambda").pdg_code: {
+                FillHist(&fCutFlow_Lambda, ELambda::kAllCombinations, n);
+                break;
+            }
+            case DB::Particles::Particle("KaonZeroShort").pdg_code: {
+                FillHist(&fCutFlow_KaonZeroShort, EKaonZeroShort::kAllCombinations, n);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
     [[nodiscard]] bool PostSeedCuts(const Seeder::PCA &pca_neg, const Seeder::PCA &pca_pos, const DB::Particles::Definition &pid) {
         switch (pid.pdg_code) {
             case DB::Particles::Particle("AntiLambda").pdg_code: {
-                return PostSeedCuts_Lambda(pca_neg, pca_pos, fHist_CutFlow_AntiLambda.get());
+                return PostSeedCuts_Lambda(pca_neg, pca_pos, &fCutFlow_AntiLambda);
             }
             case DB::Particles::Particle("Lambda").pdg_code: {
-                return PostSeedCuts_Lambda(pca_neg, pca_pos, fHist_CutFlow_Lambda.get());
+                return PostSeedCuts_Lambda(pca_neg, pca_pos, &fCutFlow_Lambda);
             }
             case DB::Particles::Particle("KaonZeroShort").pdg_code: {
-                return PostSeedCuts_KaonZeroShort(pca_neg, pca_pos, fHist_CutFlow_KaonZeroShort.get());
+                return PostSeedCuts_KaonZeroShort(pca_neg, pca_pos, &fCutFlow_KaonZeroShort);
             }
             default:
                 return false;
@@ -190,13 +341,13 @@ class Finder {
     [[nodiscard]] bool PostFitCuts(const Cached::V0 &c_v0, const DB::Particles::Definition &pid) {
         switch (pid.pdg_code) {
             case DB::Particles::Particle("AntiLambda").pdg_code: {
-                return PostFitCuts_Lambda(c_v0, fHist_CutFlow_AntiLambda.get());
+                return PostFitCuts_Lambda(c_v0, &fCutFlow_AntiLambda);
             }
             case DB::Particles::Particle("Lambda").pdg_code: {
-                return PostFitCuts_Lambda(c_v0, fHist_CutFlow_Lambda.get());
+                return PostFitCuts_Lambda(c_v0, &fCutFlow_Lambda);
             }
             case DB::Particles::Particle("KaonZeroShort").pdg_code: {
-                return PostFitCuts_KaonZeroShort(c_v0, fHist_CutFlow_KaonZeroShort.get());
+                return PostFitCuts_KaonZeroShort(c_v0, &fCutFlow_KaonZeroShort);
             }
             default:
                 return false;
@@ -205,46 +356,71 @@ class Finder {
 
     // tracks //
 
-    bool PassesCuts_Proton(const POD::Track &track, TH1D *hist_cut_flow) const;
-    bool PassesCuts_Kaon(const POD::Track &track, TH1D *hist_cut_flow) const;
-    bool PassesCuts_Pion(const POD::Track &track, TH1D *hist_cut_flow) const;
+    bool PassesCuts_Proton(const POD::Track &track, CutFlow_Proton *cut_flow) const;
+    bool PassesCuts_Kaon(const POD::Track &track, CutFlow_Kaon *cut_flow) const;
+    bool PassesCuts_Pion(const POD::Track &track, CutFlow_Pion *cut_flow) const;
 
-    POD::Extended::McParticle BuildMcTrack(unsigned int track_mc_entry, int pdg_code_hypothesis, bool include_gm);
+    POD::Extended::McParticle BuildMcTrack(const EventState &ev, unsigned int track_mc_entry, int pdg_code_hypothesis, bool include_gm)
+        requires IsMC;
+    const POD::Extended::McParticle &McTrack(EventState &ev, TrackIdx idx_track, int pdg_code_hypothesis)
+        requires IsMC;
 
     // V0s //
-    void FindV0s(const DB::Particles::Definition &pid);
-    bool PreSeedCuts_Lambda() const;         // PENDING
-    bool PreSeedCuts_KaonZeroShort() const;  // PENDING
-    bool PostSeedCuts_Lambda(const Seeder::PCA &pca_neg, const Seeder::PCA &pca_pos, TH1D *hist_cut_flow) const;
-    bool PostSeedCuts_KaonZeroShort(const Seeder::PCA &pca_neg, const Seeder::PCA &pca_pos, TH1D *hist_cut_flow) const;
-    bool PostFitCuts_Lambda(const Cached::V0 &v0, TH1D *hist_cut_flow) const;
-    bool PostFitCuts_KaonZeroShort(const Cached::V0 &v0, TH1D *hist_cut_flow) const;
-
-    POD::Extended::McParticle BuildMcV0(const POD::Extended::McParticle &mc_neg, const POD::Extended::McParticle &mc_pos, int pdg_code_hypothesis);
+    void FindV0s(EventState &ev, const DB::Particles::Definition &pid);
+    void SeedSharedV0Pairs(EventState &ev);
+    [[nodiscard]] static bool IsSharedV0Pair(const EventState &ev, Seeder::TrackView::Row row_neg, Seeder::TrackView::Row row_pos) {
+        // -- every shared pair is a pion pair, i.e. a K0S candidate, where either track also passes as (anti)proton
+        const std::uint8_t neg = ev.Tracks.selections[row_neg];
+        const std::uint8_t pos = ev.Tracks.selections[row_pos];
+        return (neg & kPiMinus) != 0 && (pos & kPiPlus) != 0 && ((neg & kAntiProton) != 0 || (pos & kProton) != 0);
+    }
+    bool PreSeedCuts_Lambda(const Seeder::TrackStore &tracks, Seeder::TrackView::Row row_neg, Seeder::TrackView::Row row_pos,
+                            CutFlow_Lambda *cut_flow) const;
+    bool PreSeedCuts_KaonZeroShort(const Seeder::TrackStore &tracks, Seeder::TrackView::Row row_neg, Seeder::TrackView::Row row_pos,
+                                   CutFlow_KaonZeroShort *cut_flow) const;
+    void CrossCheckPartners(const Seeder::TrackStore &tracks, Seeder::TrackView::Row row_neg, const Seeder::TrackView &rows_pos,
+                            std::span<const Seeder::PairGrid::Index> partners, double max_dca, const DB::Particles::Definition &pid) const;
+    void CrossCheckSurvivors(const Seeder::TrackStore &tracks, std::span<const Seeder::TrackView::Row> block_neg,
+                             std::span<const Seeder::TrackView::Row> block_pos, std::span<const std::uint32_t> survivors, double max_dca,
+                             CrossCheck::ECheck check, const DB::Particles::Definition &pid) const;
+    void CrossCheckSeedingAccuracy(const Seeder::TrackStore &tracks, std::span<const Seeder::TrackView::Row> block_neg,
+                                   std::span<const Seeder::TrackView::Row> block_pos, std::span<const double> block_dca2, double max_dca,
+                                   const DB::Particles::Definition &pid) const;
+    bool PostSeedCuts_Lambda(const Seeder::PCA &pca_neg, const Seeder::PCA &pca_pos, CutFlow_Lambda *cut_flow) const;
+    bool PostSeedCuts_KaonZeroShort(const Seeder::PCA &pca_neg, const Seeder::PCA &pca_pos, CutFlow_KaonZeroShort *cut_flow) const;
+    bool PostFitCuts_Lambda(const Cached::V0 &v0, CutFlow_Lambda *cut_flow) const;
+    bool PostFitCuts_KaonZeroShort(const Cached::V0 &v0, CutFlow_KaonZeroShort *cut_flow) const;
+
+    POD::Extended::McParticle BuildMcV0(const EventState &ev, const POD::Extended::McParticle &mc_neg, const POD::Extended::McParticle &mc_pos,
+                                        int pdg_code_hypothesis)
+        requires IsMC;
     POD::V0 Create_V0(const KF::FitResult &fit, const Seeder::PCA &neg_pca_wrt_v0, const Seeder::PCA &pos_pca_wrt_v0);
 
     // mc sexaquark //
-    POD::Linked::InjectedSexa BuildMcSexaquark(const POD::Extended::McParticle &mc_dau1, const POD::Extended::McParticle &mc_dau2);
+    POD::Linked::InjectedSexa BuildMcSexaquark(const EventState &ev, const POD::Extended::McParticle &mc_dau1, const POD::Extended::McParticle &mc_dau2)
+        requires IsMC;
+
+    void AppendBkgCandidates(EventState &ev) const;
 
     // channel A //
-    void FindSexaquarks_ChannelA(bool is_bkg_channel);
+    void FindSexaquarks_ChannelA(EventState &ev, bool is_bkg_channel);
     bool PreSeedCuts_ChannelA() const;  // PENDING
-    [[nodiscard]] bool PostSeedCuts_ChannelA(const Seeder::PCA &pca_v0a, const Seeder::PCA &pca_v0b, TH1D *hist_cut_flow) const;
-    [[nodiscard]] bool PostFitCuts_ChannelA(const Cached::ChannelA &c_sexa, TH1D *hist_cut_flow) const;
+    [[nodiscard]] bool PostSeedCuts_ChannelA(const Seeder::PCA &pca_v0a, const Seeder::PCA &pca_v0b, CutFlow_ChannelA *cut_flow) const;
+    [[nodiscard]] bool PostFitCuts_ChannelA(const Cached::ChannelA &c_sexa, CutFlow_ChannelA *cut_flow) const;
     POD::Sexaquark Create_ChannelA(const KF::FitResult &fit, const Seeder::PCA &pca_v0a, const Seeder::PCA &pca_v0b, bool is_bkg_channel);
 
     // channel D //
-    void FindSexaquarks_ChannelD(bool is_bkg_channel);
+    void FindSexaquarks_ChannelD(EventState &ev, bool is_bkg_channel);
     bool PreSeedCuts_ChannelD() const;  // PENDING
-    [[nodiscard]] bool PostSeedCuts_ChannelD(const Seeder::PCA &pca_v0, const Seeder::PCA &pca_ka, TH1D *hist_cut_flow) const;
-    [[nodiscard]] bool PostFitCuts_ChannelD(const Cached::ChannelD &c_sexa, TH1D *hist_cut_flow) const;
+    [[nodiscard]] bool PostSeedCuts_ChannelD(const Seeder::PCA &pca_v0, const Seeder::PCA &pca_ka, CutFlow_ChannelD *cut_flow) const;
+    [[nodiscard]] bool PostFitCuts_ChannelD(const Cached::ChannelD &c_sexa, CutFlow_ChannelD *cut_flow) const;
     POD::Sexaquark Create_ChannelD(const KF::FitResult &fit, const Seeder::PCA &pca_v0, const Seeder::PCA &pca_ka, bool is_bkg_channel);
 
     // channel H //
-    void FindSexaquarks_ChannelH(bool is_bkg_channel);
+    void FindSexaquarks_ChannelH(EventState &ev, bool is_bkg_channel);
     bool PreSeedCuts_ChannelH() const;  // PENDING
-    [[nodiscard]] bool PostSeedCuts_ChannelH(const Seeder::PCA &pca_kaon1, const Seeder::PCA &pca_kaon2, TH1D *hist_cut_flow) const;
-    [[nodiscard]] bool PostFitCuts_ChannelH(const Cached::ChannelH &c_sexa, TH1D *hist_cut_flow) const;
+    [[nodiscard]] bool PostSeedCuts_ChannelH(const Seeder::PCA &pca_kaon1, const Seeder::PCA &pca_kaon2, CutFlow_ChannelH *cut_flow) const;
+    [[nodiscard]] bool PostFitCuts_ChannelH(const Cached::ChannelH &c_sexa, CutFlow_ChannelH *cut_flow) const;
     POD::Sexaquark Create_ChannelH(const KF::FitResult &fit, const Seeder::PCA &pca_kaon1, const Seeder::PCA &pca_kaon2, bool is_bkg_channel);
 
     // fit configuration //
@@ -277,57 +453,22 @@ class Finder {
 
     const Settings &fSettings;
 
-    // temporary in-memory data //
-
-    std::vector<POD::Track> fTemp_AntiProton;
-    std::vector<POD::Track> fTemp_Proton;
-    std::vector<POD::Track> fTemp_NegKaon;
-    std::vector<POD::Track> fTemp_PosKaon;
-    std::vector<POD::Track> fTemp_PiMinus;
-    std::vector<POD::Track> fTemp_PiPlus;
-
-    std::vector<POD::Extended::McParticle> fTemp_MC_AntiProton;
-    std::vector<POD::Extended::McParticle> fTemp_MC_Proton;
-    std::vector<POD::Extended::McParticle> fTemp_MC_NegKaon;
-    std::vector<POD::Extended::McParticle> fTemp_MC_PosKaon;
-    std::vector<POD::Extended::McParticle> fTemp_MC_PiMinus;
-    std::vector<POD::Extended::McParticle> fTemp_MC_PiPlus;
-
-    std::vector<POD::V0> fTemp_AntiLambda;
-    std::vector<POD::Track> fTemp_AntiLambda_Neg;
-    std::vector<POD::Track> fTemp_AntiLambda_Pos;
-    std::vector<POD::V0> fTemp_Lambda;
-    std::vector<POD::Track> fTemp_Lambda_Neg;
-    std::vector<POD::Track> fTemp_Lambda_Pos;
-    std::vector<POD::V0> fTemp_KaonZeroShort;
-    std::vector<POD::Track> fTemp_KaonZeroShort_Neg;
-    std::vector<POD::Track> fTemp_KaonZeroShort_Pos;
-
-    std::vector<POD::Extended::McParticle> fTemp_MC_AntiLambda;
-    std::vector<POD::Extended::McParticle> fTemp_MC_AntiLambda_Neg;
-    std::vector<POD::Extended::McParticle> fTemp_MC_AntiLambda_Pos;
-    std::vector<POD::Extended::McParticle> fTemp_MC_Lambda;
-    std::vector<POD::Extended::McParticle> fTemp_MC_Lambda_Neg;
-    std::vector<POD::Extended::McParticle> fTemp_MC_Lambda_Pos;
-    std::vector<POD::Extended::McParticle> fTemp_MC_KaonZeroShort;
-    std::vector<POD::Extended::McParticle> fTemp_MC_KaonZeroShort_Neg;
-    std::vector<POD::Extended::McParticle> fTemp_MC_KaonZeroShort_Pos;
-
     // input //
 
-    Schema::Events fInput;
-    std::unique_ptr<Framework::TeeTree::Reader> fReader;
-    // -- cached
-    ROOT::Math::XYZPoint fPrimaryVertex;
-    double fMagneticField{0.};
+    EventState fEvent;  // only used by the sequential engine
+    InputStream fInputStream;
     // -- injected reaction channel of dedicated sexa mc production, identified on the first event
     //    without value until detected injected channel; value '0' if there are no injected particles
-    std::optional<DB::ReactionChannels::Definition> fMcSignalChannel;
+    [[no_unique_address]] Mc<std::optional<DB::ReactionChannels::Definition>> fMcSignalChannel;
+
+    // tasks //
+
+    std::unique_ptr<TaskPool> fTaskPool;  // null unless `--tasks`, then species and channels run as parallel tasks
 
     // output //
 
     std::unique_ptr<TFile> fOutput_File;  // single file, kept alive across every input file, if multiple
-    Schema::FoundSexaquark fOutput;
+    Schema::FoundSexaquark fOutput;  // bound to the writer, only holds an event while it's being filled
     std::unique_ptr<Framework::Writer> fWriter;
 
     // histograms //
@@ -352,6 +493,26 @@ class Finder {
     std::unique_ptr<TH1D> fHist_CutFlow_ChannelD_Bkg;
     std::unique_ptr<TH1D> fHist_CutFlow_ChannelH;
     std::unique_ptr<TH1D> fHist_CutFlow_ChannelH_Bkg;
+    // -- counted into by the loops, then folded into the histograms above at `EndOfAnalysis()`
+    CutFlow_Proton fCutFlow_AntiProton;
+    CutFlow_Proton fCutFlow_Proton;
+    CutFlow_Kaon fCutFlow_NegKaon;
+    CutFlow_Kaon fCutFlow_PosKaon;
+    CutFlow_Pion fCutFlow_PiMinus;
+    CutFlow_Pion fCutFlow_PiPlus;
+    CutFlow_Lambda fCutFlow_AntiLambda;
+    CutFlow_Lambda fCutFlow_Lambda;
+    CutFlow_KaonZeroShort fCutFlow_KaonZeroShort;
+    CutFlow_ChannelA fCutFlow_ChannelA;
+    CutFlow_ChannelA fCutFlow_ChannelA_Bkg;
+    CutFlow_ChannelD fCutFlow_ChannelD;
+    CutFlow_ChannelD fCutFlow_ChannelD_Bkg;
+    CutFlow_ChannelH fCutFlow_ChannelH;
+    CutFlow_ChannelH fCutFlow_ChannelH_Bkg;
 };
 
+// -- both builds are instantiated once, in `Finder.cxx`
+extern template class Finder<false>;
+extern template class Finder<true>;
+
 }  // namespace T2DS
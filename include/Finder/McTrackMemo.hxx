@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "common/POD_McParticle.hpp"
+
+namespace T2DS {
+
+// MC truth of the tracks of an event, classified under a pdg hypothesis -- memoised, as it's only built for the tracks
+// that end up in a stored candidate, and the same track often does more than once.
+// Safe to share between the tasks of an event: entries are never erased until `Clear()`, thus references stay valid.
+class McTrackMemo {
+   public:
+    // Return the memoised entry, or build it with `build()` -- outside the lock, as classifying is the expensive part.
+    // NOTE: if two tasks race for the same key, both build it and the first one to arrive is kept; they're identical.
+    template <typename Build>
+    const POD::Extended::McParticle &Get(unsigned int mc_entry, int pdg_code_hypothesis, bool include_gm, Build &&build) {
+        const Key key{.mc_entry = mc_entry, .pdg_code = pdg_code_hypothesis, .include_gm = include_gm};
+        {
+            std::lock_guard lock(fMutex);
+            if (auto it = fMemo.find(key); it != fMemo.end()) return it->second;
+        }
+        POD::Extended::McParticle mc = std::forward<Build>(build)();
+        std::lock_guard lock(fMutex);
+        return fMemo.try_emplace(key, std::move(mc)).first->second;
+    }
+
+    void Clear() {
+        std::lock_guard lock(fMutex);
+        fMemo.clear();
+    }
+
+   private:
+    struct Key {
+        unsigned int mc_entry;
+        int pdg_code;
+        bool include_gm;
+
+        bool operator==(const Key &) const = default;
+    };
+    struct KeyHash {
+        std::size_t operator()(const Key &key) const noexcept {
+            const std::uint64_t packed = (static_cast<std::uint64_t>(key.mc_entry) << 32) | static_cast<std::uint32_t>(key.pdg_code);
+            return std::hash<std::uint64_t>{}(packed) ^ static_cast<std::size_t>(key.include_gm);
+        }
+    };
+
+    std::mutex fMutex;
+    std::unordered_map<Key, POD::Extended::McParticle, KeyHash> fMemo;
+};
+
+}  // namespace T2DS
@@ -15,6 +15,7 @@
 
 #include "KalmanFitter/KalmanFitterParticle.hxx"
 #include "Seeder/BaseSeeder.hxx"
+#include "Seeder/TrackStore.hxx"
 
 namespace T2DS::KF {
 
@@ -140,6 +141,21 @@ inline FitResult FitVertex(const POD::Track& track, const POD::V0& v0, const DB:
     return FitVertex(Particle::FromTrack(track, pid_track), Particle::FromV0(v0, pid_v0, policy.daughters_already_pinned), s_track, s_v0, bz, policy);
 }
 
+// -- entries of track stores, e.g. species: kinematics come from the store, covariances from the input tracks
+inline FitResult FitVertex(const Seeder::TrackStore& store_1, std::size_t i_1, const Seeder::TrackStore& store_2, std::size_t i_2,
+                           const DB::Particles::Definition& pid_1, const DB::Particles::Definition& pid_2, const Seeder::Result& s_1,
+                           const Seeder::Result& s_2, double bz, const FitPolicy& policy = {}) {
+    return FitVertex(Particle::FromTrack(store_1.State(i_1), store_1.Covariance(i_1), pid_1),
+                     Particle::FromTrack(store_2.State(i_2), store_2.Covariance(i_2), pid_2), s_1, s_2, bz, policy);
+}
+
+inline FitResult FitVertex(const Seeder::TrackStore& store, std::size_t i, const POD::V0& v0, const DB::Particles::Definition& pid_track,
+                           const DB::Particles::Definition& pid_v0, const Seeder::Result& s_track, const Seeder::Result& s_v0, double bz,
+                           const FitPolicy& policy = {}) {
+    return FitVertex(Particle::FromTrack(store.State(i), store.Covariance(i), pid_track),
+                     Particle::FromV0(v0, pid_v0, policy.daughters_already_pinned), s_track, s_v0, bz, policy);
+}
+
 inline FitResult FitVertex(const POD::V0& v0_1, const POD::V0& v0_2, const DB::Particles::Definition& pid_1, const DB::Particles::Definition& pid_2,
                            const Seeder::Result& s_1, const Seeder::Result& s_2, const FitPolicy& policy = {}) {
     return FitVertex(Particle::FromV0(v0_1, pid_1, policy.daughters_already_pinned), Particle::FromV0(v0_2, pid_2, policy.daughters_already_pinned),
@@ -17,6 +17,7 @@
 #include "common/POD_V0.hpp"
 
 #include "App/Utilities.hxx"  // NOTE: don't remove! print formatter below needs it
+#include "Seeder/TrackStore.hxx"
 
 namespace T2DS::KF {
 
@@ -31,6 +32,8 @@ static constexpr double MassConstraint_Tolerance = 1.E-10;
 static constexpr double MassConstraint_MinDenom = 1.E-10;
 static constexpr double MassConstraint_MinVariance = 1.E-20;
 
+using TrackCovMatrix = decltype(POD::Track::CovMatrix);
+
 // ## KF::Particle ## //
 
 struct Particle {
@@ -44,6 +47,7 @@ struct Particle {
 
     Particle() = default;
     static Particle FromTrack(const POD::Track &v, const DB::Particles::Definition &pid);
+    static Particle FromTrack(const Seeder::TrackState &v, const TrackCovMatrix &cov, const DB::Particles::Definition &pid);
     static Particle FromV0(const POD::V0 &v, const DB::Particles::Definition &pid, bool on_shell);
     static Particle FromPreFoundLambda(const POD::Extended::PreFoundLambda &l, const DB::Particles::Definition &pid, bool on_shell);
 
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Seeder/BaseSeeder.hxx"
+#include "Seeder/TrackStore.hxx"
+
+namespace T2DS::Seeder {
+
+// Seeds and derivatives of a pair of tracks, as they don't depend on the mass hypotheses -- only on both helices.
+struct PairSeeds {
+    Seed seed1;
+    Seed seed2;
+    Deriv deriv1;
+    Deriv deriv2;
+    bool has_derivs{false};  // -- false if the pair was already too far apart to be fitted
+};
+
+// Per-event cache of the pairs that several hypotheses take part in, keyed by the entries of both tracks in the input.
+// It's filled before the hypotheses run, and only read from them afterwards, thus it's safe to share between tasks.
+class PairCache {
+   public:
+    using Entry = TrackStore::Entry;
+
+    void Clear() {
+        fSlot.clear();  // NOTE: keeps the buckets, as the next event will need about as many
+        fSeeds.clear();
+    }
+
+    // Reserve the slot of a pair, to be filled in through `At`.
+    std::size_t Insert(Entry entry1, Entry entry2) {
+        const auto [it, inserted] = fSlot.try_emplace(Key(entry1, entry2), static_cast<std::uint32_t>(fSeeds.size()));
+        if (inserted) fSeeds.emplace_back();
+        return it->second;
+    }
+
+    [[nodiscard]] PairSeeds &At(std::size_t slot) { return fSeeds[slot]; }
+
+    // Returns nullptr if the pair wasn't cached.
+    [[nodiscard]] const PairSeeds *Find(Entry entry1, Entry entry2) const {
+        const auto it = fSlot.find(Key(entry1, entry2));
+        return it != fSlot.end() ? &fSeeds[it->second] : nullptr;
+    }
+
+    [[nodiscard]] std::size_t Size() const { return fSeeds.size(); }
+
+   private:
+    static std::uint64_t Key(Entry entry1, Entry entry2) { return (static_cast<std::uint64_t>(entry1) << 32) | entry2; }
+
+    std::unordered_map<std::uint64_t, std::uint32_t> fSlot;
+    std::vector<PairSeeds> fSeeds;
+};
+
+}  // namespace T2DS::Seeder
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <numbers>
+#include <vector>
+
+#include "common/Constants.hpp"
+
+#include "App/Buckets.hxx"
+#include "Seeder/SeederHelixHelix.hxx"
+#include "Seeder/TrackStore.hxx"
+
+namespace T2DS::Seeder {
+
+// Uniform grid over the fiducial decay region of the transverse plane, binning the tracks of a view by the arcs of their
+// circles within it -- inflated by the reach of the pair cut -- so that the partners of a track are only looked for in
+// the cells its own arc crosses, instead of among every track of the view.
+// Any pair whose circles come within `reach` of each other inside the fiducial region shares, at least, one cell: with
+// `reach` from `HelixHelix::MaxGap_XY(...)`, the grid never misses a pair that the pre-seed cuts would accept, see
+// `HelixHelix::MeetWithin_XY(...)`. Each arc is covered by segments of about one cell, and only the tracks whose arcs
+// pass by each other are paired, however large their circles. Straight tracks are partners of every track.
+// NOTE: built per view and per event, and owned by a single task.
+class PairGrid {
+   public:
+    using Index = std::uint32_t;  // position of the track in the view
+
+    static constexpr double kHalfSize = HelixHelix::kMaxRadius_XY;  // -- the grid covers [-kHalfSize, kHalfSize] in x and y
+    static constexpr std::size_t kMaxCellsPerSide = 63;             // HARDCODED
+    static constexpr double kSlack = 1E-3;                          // HARDCODED, cm -- covers the rounding of the arcs
+    static constexpr double kMaxStep = std::numbers::pi / 4.;       // HARDCODED, rad -- longest segment of an arc
+    static constexpr std::size_t kSweepRatio = 16;                  // HARDCODED -- see `Query`
+
+    explicit PairGrid(std::pmr::memory_resource *memory)
+        : fOffset{memory}, fItems{memory}, fEverywhere{memory}, fBinned{memory}, fCursor{memory}, fCellStamp{memory}, fSeen{memory} {}
+
+    // Bin the tracks of `view`, their arcs inflated by `reach`, in cm.
+    void Build(const TrackStore &tracks, const TrackView &view, double reach) {
+        const std::size_t n = view.Size();
+        // -- odd, so that a cell is centred on the origin: the prompt tracks all pass through it, and only it
+        fNSide = std::clamp<std::size_t>(static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(n)))), 1, kMaxCellsPerSide) | 1;
+        fCellSize = 2. * kHalfSize / static_cast<double>(fNSide);
+        fReach = reach;
+        fCellStamp.assign(fNSide * fNSide, 0);
+        fStamp = 0;
+
+        fEverywhere.clear();
+        fBinned.clear();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (IsStraight(tracks, view[i])) {
+                fEverywhere.push_back(static_cast<Index>(i));
+                continue;
+            }
+            ForEachCell(tracks, view[i], reach, [&](std::size_t cell) { fBinned.push_back({static_cast<Index>(cell), static_cast<Index>(i)}); });
+        }
+        // -- the tracks of every cell, in order of the view
+        FillBuckets(
+            fNSide * fNSide,
+            [&](const auto &emit) {
+                for (const auto &[cell, i] : fBinned) emit(cell, i);
+            },
+            fOffset, fItems, fCursor);
+
+        fNTracks = n;
+        fSeen.assign(n, 0);
+    }
+
+    // Fill `partners` with the positions within the view of the tracks whose arc passes by the arc of row `row` of
+    // `tracks`, in order and without repetitions, as a loop over the whole view would visit them.
+    void Query(const TrackStore &tracks, std::size_t row, std::pmr::vector<Index> &partners) {
+        partners.clear();
+        if (IsStraight(tracks, row)) {
+            for (std::size_t i = 0; i < fNTracks; ++i) partners.push_back(static_cast<Index>(i));
+            return;
+        }
+
+        auto add = [&](Index i) {
+            if (fSeen[i] == fStamp) return;
+            fSeen[i] = fStamp;
+            partners.push_back(i);
+        };
+        ForEachCell(tracks, row, 0., [&](std::size_t cell) {
+            for (std::size_t k = fOffset[cell]; k < fOffset[cell + 1]; ++k) add(fItems[k]);
+        });
+        for (const Index i : fEverywhere) add(i);
+        // -- back in order: a sweep over the stamps is cheaper than sorting once a sizeable part of the view is found
+        if (partners.size() * kSweepRatio < fNTracks) {
+            std::sort(partners.begin(), partners.end());
+            return;
+        }
+        partners.clear();
+        for (std::size_t i = 0; i < fNTracks; ++i) {
+            if (fSeen[i] == fStamp) partners.push_back(static_cast<Index>(i));
+        }
+    }
+
+   private:
+    struct Binned {
+        Index cell;
+        Index track;
+    };
+
+    [[nodiscard]] static bool IsStraight(const TrackStore &tracks, std::size_t row) { return std::abs(tracks.bq[row]) < Common::AbsAlmostZero; }
+
+    // Call `visit(cell)` once for every cell crossed by the arc of the circle of row `row` of `tracks` within the
+    // fiducial region -- widened by the reach, as either track of a pair may lie up to half of it outside -- the arc
+    // inflated by `inflation`. Starts a new stamp.
+    template <typename Visit>
+    void ForEachCell(const TrackStore &tracks, std::size_t row, double inflation, const Visit &visit) {
+        ++fStamp;
+        const double xc = tracks.xc[row];
+        const double yc = tracks.yc[row];
+        const double r = tracks.r[row];
+
+        // -- the arc within the disc, as an interval of angles around the centre, facing the origin
+        const double max_radius = kHalfSize + fReach + kSlack;
+        const double dc = std::sqrt(xc * xc + yc * yc);
+        double phi0 = 0.;
+        double span = 2. * std::numbers::pi;
+        if (dc < Common::AbsAlmostZero) {
+            if (r > max_radius) return;
+        } else {
+            const double cos_min = (max_radius * max_radius - dc * dc - r * r) / (2. * r * dc);
+            if (cos_min < -1.) return;
+            if (cos_min < 1.) {
+                const double half = std::numbers::pi - std::acos(cos_min);
+                phi0 = std::atan2(-yc, -xc) - half;
+                span = 2. * half;
+            }
+        }
+
+        // -- segments of about one cell, each covered by the box of its chord, inflated by its sagitta
+        const auto n_segments = std::max<std::size_t>(static_cast<std::size_t>(std::ceil(std::max(r * span / fCellSize, span / kMaxStep))), 1);
+        const double step = span / static_cast<double>(n_segments);
+        const double sin_quarter = std::sin(step / 4.);
+        const double pad = 2. * r * sin_quarter * sin_quarter + inflation + kSlack;
+        double x0 = xc + r * std::cos(phi0);
+        double y0 = yc + r * std::sin(phi0);
+        for (std::size_t segment = 1; segment <= n_segments; ++segment) {
+            const double phi = phi0 + static_cast<double>(segment) * step;
+            const double x1 = xc + r * std::cos(phi);
+            const double y1 = yc + r * std::sin(phi);
+            const std::size_t ix0 = Bin(std::min(x0, x1) - pad);
+            const std::size_t ix1 = Bin(std::max(x0, x1) + pad);
+            const std::size_t iy0 = Bin(std::min(y0, y1) - pad);
+            const std::size_t iy1 = Bin(std::max(y0, y1) + pad);
+            for (std::size_t iy = iy0; iy <= iy1; ++iy) {
+                for (std::size_t ix = ix0; ix <= ix1; ++ix) {
+                    const std::size_t cell = Cell(ix, iy);
+                    if (fCellStamp[cell] == fStamp) continue;
+                    fCellStamp[cell] = fStamp;
+                    visit(cell);
+                }
+            }
+            x0 = x1;
+            y0 = y1;
+        }
+    }
+
+    // NOTE: monotonic, so that overlapping intervals stay overlapping once clamped
+    [[nodiscard]] std::size_t Bin(double coord) const {
+        const double bin = std::floor((coord + kHalfSize) / fCellSize);
+        return static_cast<std::size_t>(std::clamp(bin, 0., static_cast<double>(fNSide - 1)));
+    }
+
+    [[nodiscard]] std::size_t Cell(std::size_t ix, std::size_t iy) const { return iy * fNSide + ix; }
+
+    std::size_t fNSide{1};
+    double fCellSize{2. * kHalfSize};
+    double fReach{0.};
+    std::size_t fNTracks{0};
+
+    std::pmr::vector<Index> fOffset;  // -- tracks of cell `c` are within [fOffset[c], fOffset[c + 1])
+    std::pmr::vector<Index> fItems;
+    std::pmr::vector<Index> fEverywhere;  // -- tracks that are partners of every track
+    std::pmr::vector<Binned> fBinned;     // -- scratch, every cell of every track
+    std::pmr::vector<Index> fCursor;      // -- scratch
+    std::pmr::vector<std::uint32_t> fCellStamp;  // -- stamp of the last arc that crossed each cell
+    std::pmr::vector<std::uint32_t> fSeen;       // -- stamp of the last query that found each track
+    std::uint32_t fStamp{0};
+};
+
+}  // namespace T2DS::Seeder
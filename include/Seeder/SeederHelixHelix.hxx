@@ -1,10 +1,18 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <tuple>
 
+#include "common/Constants.hpp"
 #include "common/POD_Track.hpp"
 
 #include "Seeder/BaseSeeder.hxx"
+#include "Seeder/TrackStore.hxx"
 
 namespace T2DS::Seeder::HelixHelix {
 
@@ -49,21 +57,113 @@ struct Cache {
 
 // Main Methods //
 
-std::pair<Seed, Seed> FastPCAs_XY(const POD::Track& q1, const POD::Track& q2, double bz, Cache* cache = nullptr);
+std::pair<Seed, Seed> FastPCAs_XY(const HelixParams& h1, const HelixParams& h2, Cache* cache = nullptr);
 std::pair<Seed, Seed> CorrectPCAs_Z(const Seed& s1_xy, const Seed& s2_xy, Cache& c);
 
 std::pair<Deriv, Deriv> ComputeDerivatives_XY(Cache& c);
 std::pair<Deriv, Deriv> UpdateDerivatives_Z(const Seed& s1_xy, const Seed& s2_xy, const Deriv& d1_xy, const Deriv& d2_xy, const Cache& c);
 
+// Batched Methods //
+
+// Relative margin of the pre-filters over the cut -- the batched first phase, and the gap between circles, see
+// `MaxGap_XY(...)`: they must never reject a pair that the one-pair path keeps, despite their different rounding, e.g.
+// as FMA contraction differs between vector and scalar code, or as the vector code takes its own polynomial `atan2` and
+// `sincos`, see `Simd.hxx`. The worst error found near the cut was below 1E-10 of it, see `checks/SeedingMargins.cxx`.
+inline constexpr double kBatchMargin = 1E-6;  // HARDCODED
+// Same, when the first phase runs in float. It covers its rounding, apart from the ill-conditioned pairs, which always
+// survive it: the worst error found near the cut was about 1E-3 of it, with room left for harder events.
+inline constexpr double kBatchMargin_Float = 2E-2;  // HARDCODED
+// Largest distance between a PCA found by the batched first phase, in double, and by the one-pair path, that
+// `--cross-check` accepts.
+inline constexpr double kBatchTolerance_PCA = 1E-4;  // HARDCODED, cm
+
+void SeedDCA2(const TrackStore& s1, std::span<const TrackView::Row> rows1, const TrackStore& s2, std::span<const TrackView::Row> rows2,
+              std::span<double> dca2);
+void SeedDCA2(const TrackStore& s1, std::span<const TrackView::Row> rows1, const TrackStore& s2, std::span<const TrackView::Row> rows2,
+              std::span<float> dca2);
+void SeedPCAs(const TrackStore& s1, std::span<const TrackView::Row> rows1, const TrackStore& s2, std::span<const TrackView::Row> rows2,
+              std::span<std::array<double, 3>> pca1, std::span<std::array<double, 3>> pca2);
+std::size_t CompactSurvivors(std::span<const double> dca2, double max_dca, std::span<std::uint32_t> survivors);
+std::size_t CompactSurvivors(std::span<const float> dca2, double max_dca, std::span<std::uint32_t> survivors);
+
 // Inline Methods //
 
-inline std::tuple<Seed, Seed, Cache> FastCorrectPCAs(const POD::Track& q1, const POD::Track& q2, double bz) {
+inline std::pair<Seed, Seed> FastPCAs_XY(const TrackState& q1, const TrackState& q2, double bz, Cache* cache = nullptr) {
+    return FastPCAs_XY(HelixParams::FromState(q1, bz), HelixParams::FromState(q2, bz), cache);
+}
+
+inline std::pair<Seed, Seed> FastPCAs_XY(const POD::Track& q1, const POD::Track& q2, double bz, Cache* cache = nullptr) {
+    return FastPCAs_XY(TrackState::FromTrack(q1), TrackState::FromTrack(q2), bz, cache);
+}
+
+inline std::tuple<Seed, Seed, Cache> FastCorrectPCAs(const HelixParams& h1, const HelixParams& h2) {
     Cache cache;
-    auto [seed1_xy, seed2_xy] = FastPCAs_XY(q1, q2, bz, &cache);
+    auto [seed1_xy, seed2_xy] = FastPCAs_XY(h1, h2, &cache);
     auto [seed1, seed2] = CorrectPCAs_Z(seed1_xy, seed2_xy, cache);
     return {seed1, seed2, cache};
 }
 
+inline std::tuple<Seed, Seed, Cache> FastCorrectPCAs(const POD::Track& q1, const POD::Track& q2, double bz) {
+    return FastCorrectPCAs(HelixParams::FromState(TrackState::FromTrack(q1), bz), HelixParams::FromState(TrackState::FromTrack(q2), bz));
+}
+
+// -- entries `i1` and `i2` of two track stores, e.g. two species, filled under the same magnetic field
+inline std::tuple<Seed, Seed, Cache> FastCorrectPCAs(const TrackStore& s1, std::size_t i1, const TrackStore& s2, std::size_t i2) {
+    return FastCorrectPCAs(s1.Helix(i1), s2.Helix(i2));
+}
+
+// Lower bound of the distance between any two points of two helices -- thus of their DCA -- i.e. the gap between their
+// circles in the XY plane: the circles are apart, one is inside the other, or they cross and the bound is zero.
+// No trigonometry involved, meant to reject pairs before seeding them. Zero if either track is straight.
+inline double MinDistance_XY(const TrackStore& s1, std::size_t i1, const TrackStore& s2, std::size_t i2) {
+    if (std::abs(s1.bq[i1]) < Common::AbsAlmostZero || std::abs(s2.bq[i2]) < Common::AbsAlmostZero) return 0.;
+    const double dxc = s1.xc[i1] - s2.xc[i2];
+    const double dyc = s1.yc[i1] - s2.yc[i2];
+    const double d = std::sqrt(dxc * dxc + dyc * dyc);
+    return std::max({d - s1.r[i1] - s2.r[i2], std::abs(s1.r[i1] - s2.r[i2]) - d, 0.});
+}
+
+// Largest gap between the circles of a pair, from `MinDistance_XY(...)`, that may still pass a cut `max_dca` on their
+// DCA. Disjoint circles whose PCAs share z have a DCA equal to their gap, hence the margin.
+inline double MaxGap_XY(double max_dca) { return max_dca * (1. + kBatchMargin); }
+
+// Fiducial decay region in the XY plane, a disc around the origin, about as large as the tracking volume: the daughters
+// of decays beyond it leave no tracks.
+inline constexpr double kMaxRadius_XY = 250.;  // HARDCODED, cm
+
+// Whether the circles of two helices come within `max_gap` of each other inside the fiducial region, i.e. whether the
+// midpoint between their closest points in the XY plane is within `kMaxRadius_XY` of the origin. Those points are
+// either crossing point, if the circles cross, else the points facing each other along the line of their centres --
+// along x, if the circles are concentric. Always true if either track is straight.
+// No trigonometry involved, meant to reject pairs before seeding them, see `PairGrid`, which finds these pairs only.
+inline bool MeetWithin_XY(const TrackStore& s1, std::size_t i1, const TrackStore& s2, std::size_t i2, double max_gap) {
+    if (std::abs(s1.bq[i1]) < Common::AbsAlmostZero || std::abs(s2.bq[i2]) < Common::AbsAlmostZero) return true;
+    if (MinDistance_XY(s1, i1, s2, i2) > max_gap) return false;
+
+    const double r1 = s1.r[i1];
+    const double r2 = s2.r[i2];
+    const double dxc = s2.xc[i2] - s1.xc[i1];
+    const double dyc = s2.yc[i2] - s1.yc[i1];
+    const double d = std::sqrt(dxc * dxc + dyc * dyc);
+    // -- unit vector from the first centre to the second one
+    const double ux = d < Common::AbsAlmostZero ? 1. : dxc / d;
+    const double uy = d < Common::AbsAlmostZero ? 0. : dyc / d;
+    auto within = [](double x, double y) { return x * x + y * y <= kMaxRadius_XY * kMaxRadius_XY; };
+
+    if (d >= Common::AbsAlmostZero && d <= r1 + r2 && d >= std::abs(r1 - r2)) {
+        const double a = (d * d + r1 * r1 - r2 * r2) / (2. * d);
+        const double h = std::sqrt(std::max(r1 * r1 - a * a, 0.));
+        const double x = s1.xc[i1] + a * ux;
+        const double y = s1.yc[i1] + a * uy;
+        return within(x - h * uy, y + h * ux) || within(x + h * uy, y - h * ux);
+    }
+    // -- apart, the points face each other; nested, both lie beyond the inner circle, as seen from the outer centre
+    const bool apart = d > r1 + r2;
+    const double sign1 = apart || r1 >= r2 ? 1. : -1.;
+    const double sign2 = apart ? -1. : sign1;
+    return within((s1.xc[i1] + s2.xc[i2] + (sign1 * r1 + sign2 * r2) * ux) / 2., (s1.yc[i1] + s2.yc[i2] + (sign1 * r1 + sign2 * r2) * uy) / 2.);
+}
+
 inline std::tuple<Deriv, Deriv> ComputeDerivatives(const Seed& seed1_xy, const Seed& seed2_xy, Cache& cache) {
     auto [deriv1_xy, deriv2_xy] = ComputeDerivatives_XY(cache);
     auto [deriv1, deriv2] = UpdateDerivatives_Z(seed1_xy, seed2_xy, deriv1_xy, deriv2_xy, cache);
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <tuple>
 
 #include "common/POD_Track.hpp"
 #include "common/POD_V0.hpp"
 
 #include "Seeder/BaseSeeder.hxx"
+#include "Seeder/TrackStore.hxx"
 
 namespace T2DS::Seeder::HelixLine {
 
@@ -44,7 +46,7 @@ struct Cache {
 
 // Main Methods //
 
-std::pair<Seed, Seed> FastPCAs_XY(const POD::Track& q1, const POD::V0& n2, double bz, Cache* cache = nullptr);
+std::pair<Seed, Seed> FastPCAs_XY(const HelixParams& h1, const POD::V0& n2, Cache* cache = nullptr);
 std::pair<Seed, Seed> CorrectPCAs_Z(const Seed& s1_xy, const Seed& s2_xy, Cache& c);
 
 std::pair<Deriv, Deriv> ComputeDerivatives_XY(Cache& c);
@@ -52,13 +54,30 @@ std::pair<Deriv, Deriv> UpdateDerivatives_Z(const Seed& s1_xy, const Seed& s2_xy
 
 // Inline Methods //
 
-inline std::tuple<Seed, Seed, Cache> FastCorrectPCAs(const POD::Track& q1, const POD::V0& n2, double bz) {
+inline std::pair<Seed, Seed> FastPCAs_XY(const TrackState& q1, const POD::V0& n2, double bz, Cache* cache = nullptr) {
+    return FastPCAs_XY(HelixParams::FromState(q1, bz), n2, cache);
+}
+
+inline std::pair<Seed, Seed> FastPCAs_XY(const POD::Track& q1, const POD::V0& n2, double bz, Cache* cache = nullptr) {
+    return FastPCAs_XY(TrackState::FromTrack(q1), n2, bz, cache);
+}
+
+inline std::tuple<Seed, Seed, Cache> FastCorrectPCAs(const HelixParams& h1, const POD::V0& n2) {
     Cache cache;
-    auto [seed1_xy, seed2_xy] = FastPCAs_XY(q1, n2, bz, &cache);
+    auto [seed1_xy, seed2_xy] = FastPCAs_XY(h1, n2, &cache);
     auto [seed1, seed2] = CorrectPCAs_Z(seed1_xy, seed2_xy, cache);
     return {seed1, seed2, cache};
 }
 
+inline std::tuple<Seed, Seed, Cache> FastCorrectPCAs(const POD::Track& q1, const POD::V0& n2, double bz) {
+    return FastCorrectPCAs(HelixParams::FromState(TrackState::FromTrack(q1), bz), n2);
+}
+
+// -- entry `i1` of a track store, e.g. a species
+inline std::tuple<Seed, Seed, Cache> FastCorrectPCAs(const TrackStore& s1, std::size_t i1, const POD::V0& n2) {
+    return FastCorrectPCAs(s1.Helix(i1), n2);
+}
+
 inline std::tuple<Deriv, Deriv> ComputeDerivatives(const Seed& seed1_xy, const Seed& seed2_xy, Cache& cache) {
     auto [deriv1_xy, deriv2_xy] = ComputeDerivatives_XY(cache);
     auto [deriv1, deriv2] = UpdateDerivatives_Z(seed1_xy, seed2_xy, deriv1_xy, deriv2_xy, cache);
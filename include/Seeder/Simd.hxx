@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#define T2DS_SIMD_AVX2 1
+#endif
+
+#include "common/Math.hpp"
+
+namespace T2DS::Seeder::Simd {
+
+// Packs of doubles and floats, as wide as the target allows: four and eight lanes with AVX2 -- which the Release flags
+// target, through x86-64-v3 -- or a single one otherwise, so that the batched kernels of the seeders are written once
+// for every target and both precisions.
+#if defined(T2DS_SIMD_AVX2)
+
+struct MaskD {
+    __m256d m;
+};
+
+struct VecD {
+    using Scalar = double;
+    static constexpr std::size_t kWidth = 4;
+
+    VecD() : v{_mm256_setzero_pd()} {}
+    VecD(double x) : v{_mm256_set1_pd(x)} {}  // NOTE: implicit on purpose, to mix packs and constants
+    VecD(__m256d x) : v{x} {}
+
+    static VecD Load(const double *ptr) { return _mm256_loadu_pd(ptr); }
+    void Store(double *ptr) const { _mm256_storeu_pd(ptr, v); }
+
+    friend VecD operator+(VecD a, VecD b) { return _mm256_add_pd(a.v, b.v); }
+    friend VecD operator-(VecD a, VecD b) { return _mm256_sub_pd(a.v, b.v); }
+    friend VecD operator*(VecD a, VecD b) { return _mm256_mul_pd(a.v, b.v); }
+    friend VecD operator/(VecD a, VecD b) { return _mm256_div_pd(a.v, b.v); }
+    friend VecD operator-(VecD a) { return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.)); }
+
+    friend VecD Sqrt(VecD a) { return _mm256_sqrt_pd(a.v); }
+    friend VecD Abs(VecD a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.), a.v); }
+    friend VecD Max(VecD a, VecD b) { return _mm256_max_pd(a.v, b.v); }
+
+    friend MaskD operator<(VecD a, VecD b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)}; }
+    // -- lanes of `a` where `mask` is set, of `b` elsewhere
+    friend VecD Select(MaskD mask, VecD a, VecD b) { return _mm256_blendv_pd(b.v, a.v, mask.m); }
+
+    __m256d v;
+};
+
+struct MaskF {
+    __m256 m;
+};
+
+struct VecF {
+    using Scalar = float;
+    static constexpr std::size_t kWidth = 8;
+
+    VecF() : v{_mm256_setzero_ps()} {}
+    VecF(float x) : v{_mm256_set1_ps(x)} {}  // NOTE: implicit on purpose, to mix packs and constants
+    VecF(__m256 x) : v{x} {}
+
+    static VecF Load(const float *ptr) { return _mm256_loadu_ps(ptr); }
+    void Store(float *ptr) const { _mm256_storeu_ps(ptr, v); }
+
+    friend VecF operator+(VecF a, VecF b) { return _mm256_add_ps(a.v, b.v); }
+    friend VecF operator-(VecF a, VecF b) { return _mm256_sub_ps(a.v, b.v); }
+    friend VecF operator*(VecF a, VecF b) { return _mm256_mul_ps(a.v, b.v); }
+    friend VecF operator/(VecF a, VecF b) { return _mm256_div_ps(a.v, b.v); }
+    friend VecF operator-(VecF a) { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.F)); }
+
+    friend VecF Sqrt(VecF a) { return _mm256_sqrt_ps(a.v); }
+    friend VecF Abs(VecF a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.F), a.v); }
+    friend VecF Max(VecF a, VecF b) { return _mm256_max_ps(a.v, b.v); }
+
+    friend MaskF operator<(VecF a, VecF b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)}; }
+    // -- lanes of `a` where `mask` is set, of `b` elsewhere
+    friend VecF Select(MaskF mask, VecF a, VecF b) { return _mm256_blendv_ps(b.v, a.v, mask.m); }
+
+    __m256 v;
+};
+
+#else
+
+struct MaskD {
+    bool m;
+};
+
+struct VecD {
+    using Scalar = double;
+    static constexpr std::size_t kWidth = 1;
+
+    VecD() = default;
+    VecD(double x) : v{x} {}  // NOTE: implicit on purpose, to mix packs and constants
+
+    static VecD Load(const double *ptr) { return *ptr; }
+    void Store(double *ptr) const { *ptr = v; }
+
+    friend VecD operator+(VecD a, VecD b) { return a.v + b.v; }
+    friend VecD operator-(VecD a, VecD b) { return a.v - b.v; }
+    friend VecD operator*(VecD a, VecD b) { return a.v * b.v; }
+    friend VecD operator/(VecD a, VecD b) { return a.v / b.v; }
+    friend VecD operator-(VecD a) { return -a.v; }
+
+    friend VecD Sqrt(VecD a) { return std::sqrt(a.v); }
+    friend VecD Abs(VecD a) { return std::abs(a.v); }
+    friend VecD Max(VecD a, VecD b) { return std::max(a.v, b.v); }
+
+    friend MaskD operator<(VecD a, VecD b) { return {a.v < b.v}; }
+    friend VecD Select(MaskD mask, VecD a, VecD b) { return mask.m ? a : b; }
+
+    double v{};
+};
+
+struct MaskF {
+    bool m;
+};
+
+struct VecF {
+    using Scalar = float;
+    static constexpr std::size_t kWidth = 1;
+
+    VecF() = default;
+    VecF(float x) : v{x} {}  // NOTE: implicit on purpose, to mix packs and constants
+
+    static VecF Load(const float *ptr) { return *ptr; }
+    void Store(float *ptr) const { *ptr = v; }
+
+    friend VecF operator+(VecF a, VecF b) { return a.v + b.v; }
+    friend VecF operator-(VecF a, VecF b) { return a.v - b.v; }
+    friend VecF operator*(VecF a, VecF b) { return a.v * b.v; }
+    friend VecF operator/(VecF a, VecF b) { return a.v / b.v; }
+    friend VecF operator-(VecF a) { return -a.v; }
+
+    friend VecF Sqrt(VecF a) { return std::sqrt(a.v); }
+    friend VecF Abs(VecF a) { return std::abs(a.v); }
+    friend VecF Max(VecF a, VecF b) { return std::max(a.v, b.v); }
+
+    friend MaskF operator<(VecF a, VecF b) { return {a.v < b.v}; }
+    friend VecF Select(MaskF mask, VecF a, VecF b) { return mask.m ? a : b; }
+
+    float v{};
+};
+
+#endif
+
+// Pack of the given scalar type, e.g. `Pack<float>`, for the kernels templated on their precision.
+template <typename T>
+using Pack = std::conditional_t<std::is_same_v<T, float>, VecF, VecD>;
+
+#if defined(T2DS_SIMD_AVX2)
+
+namespace Detail {
+
+inline __m256d Polynomial(__m256d x, std::initializer_list<double> coefficients) {
+    // -- Horner's scheme, from the highest degree down
+    auto it = coefficients.begin();
+    __m256d sum = _mm256_set1_pd(*it);
+    for (++it; it != coefficients.end(); ++it) sum = _mm256_fmadd_pd(sum, x, _mm256_set1_pd(*it));
+    return sum;
+}
+
+inline __m256 Polynomial(__m256 x, std::initializer_list<float> coefficients) {
+    auto it = coefficients.begin();
+    __m256 sum = _mm256_set1_ps(*it);
+    for (++it; it != coefficients.end(); ++it) sum = _mm256_fmadd_ps(sum, x, _mm256_set1_ps(*it));
+    return sum;
+}
+
+// -- the sign bit of `sign` into `x`, i.e. `x` if `sign` is positive, `-x` otherwise
+inline __m256d FlipSign(__m256d x, __m256d sign) { return _mm256_xor_pd(x, _mm256_and_pd(sign, _mm256_set1_pd(-0.))); }
+inline __m256 FlipSign(__m256 x, __m256 sign) { return _mm256_xor_ps(x, _mm256_and_ps(sign, _mm256_set1_ps(-0.F))); }
+
+}  // namespace Detail
+
+// Four-quadrant arctangent, by the rational approximation of Cephes' `atan` over [0, 0.66], after reducing `|y/x|` or
+// `|x/y|` into [0, 1] and, beyond 0.66, by pi/4.
+// Accuracy: within 5E-16, absolute -- 1 ulp of pi -- over finite arguments, measured against `atan2l`. The sign bits of
+// both arguments pick the quadrant, so that `y = -0.` gives `-pi` for negative `x`, as `std::atan2` does.
+// NOTE: `Atan2(0., 0.)` is `0.`, signed as `y`, or `pi` if `x` is `-0.`; infinite arguments aren't supported
+inline VecD Atan2(VecD y, VecD x) {
+    const __m256d sign_mask = _mm256_set1_pd(-0.);
+    const __m256d ax = _mm256_andnot_pd(sign_mask, x.v);
+    const __m256d ay = _mm256_andnot_pd(sign_mask, y.v);
+
+    // -- a = min / max, within [0, 1], and 0 if both are 0
+    const __m256d swap = _mm256_cmp_pd(ay, ax, _CMP_GT_OQ);
+    const __m256d num = _mm256_blendv_pd(ay, ax, swap);
+    const __m256d den = _mm256_blendv_pd(ax, ay, swap);
+    const __m256d zero = _mm256_cmp_pd(den, _mm256_setzero_pd(), _CMP_EQ_OQ);
+    __m256d a = _mm256_blendv_pd(_mm256_div_pd(num, den), _mm256_setzero_pd(), zero);
+
+    // -- beyond 0.66, atan(a) = pi/4 + atan((a - 1) / (a + 1))
+    constexpr double kPiOver4 = 0.78539816339744830962;
+    constexpr double kMoreBits = 6.123233995736765886130E-17;  // -- pi/2 - double(pi/2)
+    const __m256d reduce = _mm256_cmp_pd(a, _mm256_set1_pd(0.66), _CMP_GT_OQ);
+    const __m256d offset = _mm256_and_pd(reduce, _mm256_set1_pd(kPiOver4));
+    const __m256d offset_lo = _mm256_and_pd(reduce, _mm256_set1_pd(0.5 * kMoreBits));
+    a = _mm256_blendv_pd(a, _mm256_div_pd(_mm256_sub_pd(a, _mm256_set1_pd(1.)), _mm256_add_pd(a, _mm256_set1_pd(1.))), reduce);
+
+    // -- atan(a) = a + a * z * P(z) / Q(z), with z = a^2
+    const __m256d z = _mm256_mul_pd(a, a);
+    const __m256d p = Detail::Polynomial(z, {-8.750608600031904122785E-1, -1.615753718733365076637E1, -7.500855792314704667340E1,
+                                             -1.228866684490136173410E2, -6.485021904942025371773E1});
+    const __m256d q = Detail::Polynomial(z, {1., 2.485846490142306297962E1, 1.650270098316988542046E2, 4.328810604912902668951E2,
+                                             4.853903996359136964868E2, 1.945506571482613964425E2});
+    __m256d r = _mm256_fmadd_pd(_mm256_mul_pd(a, z), _mm256_div_pd(p, q), a);
+    r = _mm256_add_pd(offset, _mm256_add_pd(r, offset_lo));
+
+    // -- back to the quadrant of (x, y)
+    constexpr double kPiOver2 = 1.57079632679489661923;
+    constexpr double kPi = 3.14159265358979323846;
+    r = _mm256_blendv_pd(r, _mm256_sub_pd(_mm256_add_pd(_mm256_set1_pd(kPiOver2), _mm256_set1_pd(kMoreBits)), r), swap);
+    r = _mm256_blendv_pd(r, _mm256_sub_pd(_mm256_add_pd(_mm256_set1_pd(kPi), _mm256_set1_pd(2. * kMoreBits)), r), x.v);  // -- by the sign bit of x
+    return Detail::FlipSign(r, y.v);
+}
+
+// Sine and cosine at once, by the minimax polynomials of fdlibm's `__kernel_sin` and `__kernel_cos` over [-pi/4, pi/4],
+// after reducing `x` by the nearest multiple of pi/2, in two parts through FMA.
+// Accuracy: within 2E-16, absolute, for |x| < 1E6, measured against `sinl` and `cosl`; the reduction loses bits beyond.
+inline void SinCos(VecD x, VecD &sin, VecD &cos) {
+    constexpr double kTwoOverPi = 0.63661977236758134308;
+    constexpr double kPiOver2_Hi = 1.57079632679489655800E+00;
+    constexpr double kPiOver2_Lo = 6.12323399573676603587E-17;
+
+    const __m256d n = _mm256_round_pd(_mm256_mul_pd(x.v, _mm256_set1_pd(kTwoOverPi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_fnmadd_pd(n, _mm256_set1_pd(kPiOver2_Hi), x.v);
+    r = _mm256_fnmadd_pd(n, _mm256_set1_pd(kPiOver2_Lo), r);
+    const __m256d r2 = _mm256_mul_pd(r, r);
+
+    // -- sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2)
+    const __m256d s = Detail::Polynomial(r2, {1.58969099521155010221E-10, -2.50507602534068634195E-08, 2.75573137070700676789E-06,
+                                              -1.98412698298579493134E-04, 8.33333333332248946124E-03, -1.66666666666666324348E-01});
+    const __m256d c = Detail::Polynomial(r2, {-1.13596475577881948265E-11, 2.08757232129817482790E-09, -2.75573143513906633035E-07,
+                                              2.48015872894767294178E-05, -1.38888888888741095749E-03, 4.16666666666666019037E-02});
+    const __m256d sin_r = _mm256_fmadd_pd(_mm256_mul_pd(r, r2), s, r);
+    const __m256d cos_r = _mm256_fmadd_pd(_mm256_mul_pd(r2, r2), c, _mm256_fnmadd_pd(_mm256_set1_pd(0.5), r2, _mm256_set1_pd(1.)));
+
+    // -- quadrant, n mod 4: odd ones swap sine and cosine, the sine is negative in 2 and 3, the cosine in 1 and 2
+    const auto modulo = [](__m256d a, double b) {
+        return _mm256_fnmadd_pd(_mm256_set1_pd(b), _mm256_floor_pd(_mm256_mul_pd(a, _mm256_set1_pd(1. / b))), a);
+    };
+    const __m256d quadrant = modulo(n, 4.);
+    const __m256d odd = _mm256_cmp_pd(modulo(quadrant, 2.), _mm256_set1_pd(1.), _CMP_EQ_OQ);
+    const __m256d neg_sin = _mm256_cmp_pd(quadrant, _mm256_set1_pd(2.), _CMP_GE_OQ);
+    const __m256d neg_cos =
+        _mm256_and_pd(_mm256_cmp_pd(quadrant, _mm256_set1_pd(1.), _CMP_GE_OQ), _mm256_cmp_pd(quadrant, _mm256_set1_pd(2.), _CMP_LE_OQ));
+    sin = Detail::FlipSign(_mm256_blendv_pd(sin_r, cos_r, odd), neg_sin);
+    cos = Detail::FlipSign(_mm256_blendv_pd(cos_r, sin_r, odd), neg_cos);
+}
+
+// As `Atan2(VecD, VecD)`, by Cephes' `atanf` over [0, tan(pi/8)], after reducing `|y/x|` or `|x/y|` into [0, 1] and,
+// beyond tan(pi/8), by pi/4.
+// Accuracy: within 3E-7, absolute -- 1 ulp of pi -- over finite arguments, measured against `atan2`.
+inline VecF Atan2(VecF y, VecF x) {
+    const __m256 sign_mask = _mm256_set1_ps(-0.F);
+    const __m256 ax = _mm256_andnot_ps(sign_mask, x.v);
+    const __m256 ay = _mm256_andnot_ps(sign_mask, y.v);
+
+    const __m256 swap = _mm256_cmp_ps(ay, ax, _CMP_GT_OQ);
+    const __m256 num = _mm256_blendv_ps(ay, ax, swap);
+    const __m256 den = _mm256_blendv_ps(ax, ay, swap);
+    const __m256 zero = _mm256_cmp_ps(den, _mm256_setzero_ps(), _CMP_EQ_OQ);
+    __m256 a = _mm256_blendv_ps(_mm256_div_ps(num, den), _mm256_setzero_ps(), zero);
+
+    constexpr float kTanPiOver8 = 0.4142135623730950F;
+    constexpr float kPiOver4 = 0.78539816339744830962F;
+    const __m256 reduce = _mm256_cmp_ps(a, _mm256_set1_ps(kTanPiOver8), _CMP_GT_OQ);
+    const __m256 offset = _mm256_and_ps(reduce, _mm256_set1_ps(kPiOver4));
+    a = _mm256_blendv_ps(a, _mm256_div_ps(_mm256_sub_ps(a, _mm256_set1_ps(1.F)), _mm256_add_ps(a, _mm256_set1_ps(1.F))), reduce);
+
+    // -- atan(a) = a + a * z * P(z), with z = a^2
+    const __m256 z = _mm256_mul_ps(a, a);
+    const __m256 p = Detail::Polynomial(z, {8.05374449538E-2F, -1.38776856032E-1F, 1.99777106478E-1F, -3.33329491539E-1F});
+    __m256 r = _mm256_add_ps(offset, _mm256_fmadd_ps(_mm256_mul_ps(a, z), p, a));
+
+    constexpr float kPiOver2 = 1.57079632679489661923F;
+    constexpr float kPi = 3.14159265358979323846F;
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(kPiOver2), r), swap);
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(kPi), r), x.v);  // -- by the sign bit of x
+    return Detail::FlipSign(r, y.v);
+}
+
+// As `SinCos(VecD, ...)`, by the polynomials of Cephes' `sinf` and `cosf` over [-pi/4, pi/4], after reducing `x` by
+// the nearest multiple of pi/2, in three parts through FMA.
+// Accuracy: within 1E-7, absolute, for |x| < 1E4, measured against `sin` and `cos`.
+inline void SinCos(VecF x, VecF &sin, VecF &cos) {
+    constexpr float kTwoOverPi = 0.63661977236758134308F;
+    constexpr float kPiOver2_1 = 1.5703125F;
+    constexpr float kPiOver2_2 = 4.837512969970703125E-4F;
+    constexpr float kPiOver2_3 = 7.54978995489188216E-8F;
+
+    const __m256 n = _mm256_round_ps(_mm256_mul_ps(x.v, _mm256_set1_ps(kTwoOverPi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(kPiOver2_1), x.v);
+    r = _mm256_fnmadd_ps(n, _mm256_set1_ps(kPiOver2_2), r);
+    r = _mm256_fnmadd_ps(n, _mm256_set1_ps(kPiOver2_3), r);
+    const __m256 r2 = _mm256_mul_ps(r, r);
+
+    const __m256 s = Detail::Polynomial(r2, {-1.9515295891E-4F, 8.3321608736E-3F, -1.6666654611E-1F});
+    const __m256 c = Detail::Polynomial(r2, {2.443315711809948E-5F, -1.388731625493765E-3F, 4.166664568298827E-2F});
+    const __m256 sin_r = _mm256_fmadd_ps(_mm256_mul_ps(r, r2), s, r);
+    const __m256 cos_r = _mm256_fmadd_ps(_mm256_mul_ps(r2, r2), c, _mm256_fnmadd_ps(_mm256_set1_ps(0.5F), r2, _mm256_set1_ps(1.F)));
+
+    const auto modulo = [](__m256 a, float b) {
+        return _mm256_fnmadd_ps(_mm256_set1_ps(b), _mm256_floor_ps(_mm256_mul_ps(a, _mm256_set1_ps(1.F / b))), a);
+    };
+    const __m256 quadrant = modulo(n, 4.F);
+    const __m256 odd = _mm256_cmp_ps(modulo(quadrant, 2.F), _mm256_set1_ps(1.F), _CMP_EQ_OQ);
+    const __m256 neg_sin = _mm256_cmp_ps(quadrant, _mm256_set1_ps(2.F), _CMP_GE_OQ);
+    const __m256 neg_cos =
+        _mm256_and_ps(_mm256_cmp_ps(quadrant, _mm256_set1_ps(1.F), _CMP_GE_OQ), _mm256_cmp_ps(quadrant, _mm256_set1_ps(2.F), _CMP_LE_OQ));
+    sin = Detail::FlipSign(_mm256_blendv_ps(sin_r, cos_r, odd), neg_sin);
+    cos = Detail::FlipSign(_mm256_blendv_ps(cos_r, sin_r, odd), neg_cos);
+}
+
+#else
+
+// Without SIMD, lane by lane through the same scalar functions as the one-pair seeders.
+inline VecD Atan2(VecD y, VecD x) { return std::atan2(y.v, x.v); }
+
+inline void SinCos(VecD x, VecD &sin, VecD &cos) { std::tie(sin.v, cos.v) = Common::Math::sincos(x.v); }
+
+inline VecF Atan2(VecF y, VecF x) { return std::atan2(y.v, x.v); }
+
+inline void SinCos(VecF x, VecF &sin, VecF &cos) {
+    sin.v = std::sin(x.v);
+    cos.v = std::cos(x.v);
+}
+
+#endif
+
+}  // namespace T2DS::Seeder::Simd
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "common/Constants.hpp"
+#include "common/POD_Track.hpp"
+
+#include "App/AlignedAllocator.hxx"
+
+namespace T2DS::Seeder {
+
+// Kinematics of a single track, in double precision -- all the seeders need from it.
+struct TrackState {
+    static TrackState FromTrack(const POD::Track &track) {
+        return {
+            .x = static_cast<double>(track.X),
+            .y = static_cast<double>(track.Y),
+            .z = static_cast<double>(track.Z),
+            .px = static_cast<double>(track.Px),
+            .py = static_cast<double>(track.Py),
+            .pz = static_cast<double>(track.Pz),
+            .charge = static_cast<double>(track.Charge),
+        };
+    }
+
+    double x{}, y{}, z{};
+    double px{}, py{}, pz{};
+    double charge{};
+};
+
+// Helix of a charged particle under a homogeneous magnetic field along z, i.e. the terms that depend on a single track,
+// shared by every pair the track takes part in.
+struct HelixParams {
+    static HelixParams FromState(const TrackState &state, double bz) {
+        HelixParams h{.state = state};
+        h.bq = bz * state.charge * Common::Kappa;
+        h.pt2 = state.px * state.px + state.py * state.py;
+        // -- circle in the XY plane
+        // NOTE: a neutral particle, or a null field, gives a straight line, i.e. a circle of infinite radius
+        if (h.bq != 0.) {
+            h.xc = state.x + state.py / h.bq;
+            h.yc = state.y - state.px / h.bq;
+            h.r = std::sqrt(h.pt2) / std::abs(h.bq);
+        } else {
+            h.r = std::numeric_limits<double>::infinity();
+        }
+        return h;
+    }
+
+    TrackState state;
+    double bq{};  // bz * q * kappa
+    double pt2{};
+    double xc{}, yc{};
+    double r{};
+};
+
+// Structure-of-arrays view of the selected tracks of an event, each stored once, together with the bitmask of the
+// selections -- e.g. species -- it passed. Pair loops stream through the kinematics and helix columns, while the rest
+// of `POD::Track` -- covariance, PID and TPC info -- is left in the input, and only looked up for the pairs that reach
+// the fit.
+// NOTE: only valid as long as the tracks given to `Reset` aren't modified.
+struct TrackStore {
+    using Entry = std::uint32_t;  // entry of the track in the input
+
+    void Reset(std::span<const POD::Track> tracks, double bz) {
+        Clear();
+        source = tracks;
+        magnetic_field = bz;
+    }
+
+    void Add(Entry entry_track, std::uint8_t passed) {
+        const HelixParams h = HelixParams::FromState(TrackState::FromTrack(source[entry_track]), magnetic_field);
+        x.push_back(h.state.x);
+        y.push_back(h.state.y);
+        z.push_back(h.state.z);
+        px.push_back(h.state.px);
+        py.push_back(h.state.py);
+        pz.push_back(h.state.pz);
+        charge.push_back(h.state.charge);
+        bq.push_back(h.bq);
+        pt2.push_back(h.pt2);
+        xc.push_back(h.xc);
+        yc.push_back(h.yc);
+        r.push_back(h.r);
+        entry.push_back(entry_track);
+        selections.push_back(passed);
+    }
+
+    void Clear() {
+        x.clear();
+        y.clear();
+        z.clear();
+        px.clear();
+        py.clear();
+        pz.clear();
+        charge.clear();
+        bq.clear();
+        pt2.clear();
+        xc.clear();
+        yc.clear();
+        r.clear();
+        entry.clear();
+        selections.clear();
+        source = {};
+        magnetic_field = 0.;
+    }
+
+    [[nodiscard]] std::size_t Size() const { return entry.size(); }
+    [[nodiscard]] bool Empty() const { return entry.empty(); }
+
+    [[nodiscard]] TrackState State(std::size_t i) const {
+        return {.x = x[i], .y = y[i], .z = z[i], .px = px[i], .py = py[i], .pz = pz[i], .charge = charge[i]};
+    }
+    [[nodiscard]] HelixParams Helix(std::size_t i) const {
+        return {.state = State(i), .bq = bq[i], .pt2 = pt2[i], .xc = xc[i], .yc = yc[i], .r = r[i]};
+    }
+    [[nodiscard]] const POD::Track &Track(std::size_t i) const { return source[entry[i]]; }
+    [[nodiscard]] const auto &Covariance(std::size_t i) const { return Track(i).CovMatrix; }
+
+    // kinematics columns //
+    AlignedVector<double> x, y, z;
+    AlignedVector<double> px, py, pz;
+    AlignedVector<double> charge;
+    // helix columns //
+    AlignedVector<double> bq, pt2;
+    AlignedVector<double> xc, yc, r;
+    // -- entry of each track in `source`
+    std::vector<Entry> entry;
+    // -- bitmask of the selections each track passed, as defined by the user of the store
+    std::vector<std::uint8_t> selections;
+
+    std::span<const POD::Track> source;
+    double magnetic_field{};
+};
+
+// Rows of a `TrackStore` that passed one of its selections, in order. A track passing several of them is stored once,
+// and only referred to by each.
+struct TrackView {
+    using Row = std::uint32_t;  // row of the track in the store
+
+    TrackView() = default;
+    explicit TrackView(std::pmr::memory_resource *memory) : rows{memory} {}
+
+    [[nodiscard]] std::size_t Size() const { return rows.size(); }
+    [[nodiscard]] bool Empty() const { return rows.empty(); }
+    [[nodiscard]] Row operator[](std::size_t i) const { return rows[i]; }
+
+    std::pmr::vector<Row> rows;
+};
+
+}  // namespace T2DS::Seeder
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <exception>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -18,7 +18,12 @@
 #include "common/Schema_Events.hpp"
 #include "common/Schema_FoundHdibaryon.hpp"
 
+#include "App/Arena.hxx"
+#include "App/CutFlow.hxx"
+#include "App/InputStream.hxx"
 #include "App/Logger.hxx"
+#include "App/McIndex.hxx"
+#include "App/McOnly.hxx"
 #include "App/Settings.hxx"
 #include "KalmanFitter/KalmanFitterParticle.hxx"
 
@@ -33,6 +38,9 @@ namespace Seeder { struct PCA; }
 namespace KF { struct FitResult; }
 // clang-format on
 
+// Refit the pre-found (anti)lambdas, then combine them into (anti)h-dibaryon candidates.
+// Built for either data or MC, chosen once in `main`: the data build carries none of the MC branches nor storage.
+template <bool IsMC>
 class Verifier {
 
     // Fit-Related //
@@ -50,6 +58,11 @@ class Verifier {
         bool pin_hdib_to_pv{false};        // 2nd fit, final step: pin particle to known production vertex
     };
 
+    // MC-related //
+
+    template <typename T>
+    using Mc = McOnly<IsMC, T>;
+
     // Cut-related //
 
     enum class EPreFoundLambda : int {
@@ -110,9 +123,11 @@ class Verifier {
         // --
         kNLambdaPairCuts,
     };
-    template <typename E>
-    void FillHist(TH1D *hist, const E &bin_n) {
-        hist->Fill(static_cast<double>(bin_n));
+    using CutFlow_PreFoundLambda = CutFlow<EPreFoundLambda, EPreFoundLambda::kNPreFoundLambdaCuts>;
+    using CutFlow_LambdaPair = CutFlow<ELambdaPair, ELambdaPair::kNLambdaPairCuts>;
+    template <typename E, E NCuts>
+    static void FillHist(CutFlow<E, NCuts> *cut_flow, E cut) {
+        cut_flow->Count(cut);
     }
 
    public:
@@ -126,37 +141,35 @@ class Verifier {
         : fSettings{settings},
           // input
           fInput{},
-          fReader{nullptr},
+          fInputStream{[this](Schema::Events &staging, std::string_view path) {
+                           return std::make_unique<Framework::TeeTree::Reader>(staging.CreateModel_TeeTree(IsMC, false),
+                                                                               E2T::Name_OutputTree, path);
+                       },
+                       fSettings.ReadAhead, fSettings.PreOpen},
           // output
           fOutput_File{std::make_unique<TFile>(fSettings.PathOutputFile.c_str(), "RECREATE")},
           fOutput{},
           fWriter{nullptr} {
 
-        fWriter = std::make_unique<Framework::Writer>(fOutput.CreateModel(fSettings.IsMC), T2DS::Name_FoundHdibaryonRNT, *fOutput_File);
+        fWriter = std::make_unique<Framework::Writer>(fOutput.CreateModel(IsMC), T2DS::Name_FoundHdibaryonRNT, *fOutput_File);
 
         PrepareOutputHistograms();
 
         Logger::Info(__FUNCTION__, "Verifier initialized successfully.");
     }
 
-    [[nodiscard]] bool OpenInput(std::string_view path) {
-        fReader.reset();  // raw `TTree*` must die first
-        try {
-            fReader = std::make_unique<Framework::TeeTree::Reader>(fInput.CreateModel_TeeTree(fSettings.IsMC, false), E2T::Name_OutputTree, path);
-        } catch (const std::exception &exc) {
-            Logger::Error(__FUNCTION__, "Couldn't read {} ({}) -- skipping it.", path, exc.what());
-            return false;
-        }
-        return true;
-    }
+    [[nodiscard]] bool OpenInput(std::string_view path) { return fInputStream.Open(path); }
+    void PreOpenInput(std::string_view path, long long first_entry) { fInputStream.PreOpen(path, first_entry); }
 
     void PrepareOutputHistograms();
 
-    void Load(long long entry_idx) { fReader->Load(entry_idx); }
-    [[nodiscard]] unsigned long NumberEventsToRead() { return static_cast<unsigned long>(fReader->GetEntries()); }
+    void Load(long long entry_idx) { fInputStream.Load(entry_idx, fInput); }
+    void ReadAhead(long long entry_idx) { fInputStream.ReadAhead(entry_idx); }
+    [[nodiscard]] unsigned long NumberEventsToRead() { return fInputStream.GetEntries(); }
 
     void ProcessEvent();
-    void ProcessInjected();
+    void ProcessInjected()
+        requires IsMC;
     void ProcessPreFoundLambda();
 
     void Verify() {
@@ -170,10 +183,12 @@ class Verifier {
 
    private:
     // injected //
-    POD::InjectedHdib BuildInjectedHdibaryon(const POD::McParticle &mc);
+    POD::InjectedHdib BuildInjectedHdibaryon(std::size_t mc_entry)
+        requires IsMC;
 
     // mc charged track //
-    POD::Extended::McParticle BuildMcTrack(unsigned int track_mc_entry, const HD::DecayTree &decay_pid, int pdg_code_hypothesis);
+    POD::Extended::McParticle BuildMcTrack(unsigned int track_mc_entry, const HD::DecayTree &decay_pid, int pdg_code_hypothesis)
+        requires IsMC;
     [[nodiscard]] POD::Track ExtractTrack(const POD::PreFoundLambda &pod_lambda, short charge) const;
 
     // pre-found on-the-fly (anti)lambdas //
@@ -183,7 +198,8 @@ class Verifier {
     bool PostFitCuts_Lambda(const Cached::PreFoundLambda &c_lambda);
 
     POD::Extended::McParticle BuildMcPreFoundLambda(const POD::Extended::McParticle &mc_neg, const POD::Extended::McParticle &mc_pos,
-                                                    const HD::DecayTree &decay_pid);
+                                                    const HD::DecayTree &decay_pid)
+        requires IsMC;
     POD::Extended::PreFoundLambda CreateExtendedPreFoundLambda(const POD::PreFoundLambda &old_lambda, const KF::FitResult &fit,
                                                                const Seeder::PCA &pca_neg, const Seeder::PCA &pca_pos, bool anti_lambda);
 
@@ -191,12 +207,13 @@ class Verifier {
     void VerifyLambdaPair(bool anti_channel_l1, bool anti_channel_l2);
 
     [[nodiscard]] bool PreSeedCuts_Hdibaryon(const POD::Extended::PreFoundLambda &lambda1, const POD::Extended::PreFoundLambda &lambda2,
-                                             TH1D *hist_cut_flow);
-    [[nodiscard]] bool PostSeedCuts_Hdibaryon(const Seeder::PCA &pca_lambda1, const Seeder::PCA &pca_lambda2, TH1D *hist_cut_flow);
-    [[nodiscard]] bool PostFitCuts_Hdibaryon(const Cached::Hdibaryon &c_hdib, TH1D *hist_cut_flow);
+                                             CutFlow_LambdaPair *cut_flow);
+    [[nodiscard]] bool PostSeedCuts_Hdibaryon(const Seeder::PCA &pca_lambda1, const Seeder::PCA &pca_lambda2, CutFlow_LambdaPair *cut_flow);
+    [[nodiscard]] bool PostFitCuts_Hdibaryon(const Cached::Hdibaryon &c_hdib, CutFlow_LambdaPair *cut_flow);
 
     POD::Extended::McParticle BuildMcHdibaryon(const POD::Extended::McParticle &mc_lambda1, const POD::Extended::McParticle &mc_lambda2,
-                                               int pdg_code_hypothesis);
+                                               int pdg_code_hypothesis)
+        requires IsMC;
     POD::LambdaPair CreateLambdaPair(const KF::FitResult &fit, const Seeder::PCA &pca_lambda1, const Seeder::PCA &pca_lambda2);
 
     // fit configuration //
@@ -234,23 +251,25 @@ class Verifier {
 
     // temporary pre-found lambdas, extended for KF usage //
 
-    std::vector<POD::Extended::PreFoundLambda> fTemp_AntiLambda;
-    std::vector<POD::Extended::PreFoundLambda> fTemp_Lambda;
-    std::vector<POD::Extended::McParticle> fTemp_MC_AntiLambda;
-    std::vector<POD::Extended::McParticle> fTemp_MC_AntiLambda_Neg;
-    std::vector<POD::Extended::McParticle> fTemp_MC_AntiLambda_Pos;
-    std::vector<POD::Extended::McParticle> fTemp_MC_Lambda;
-    std::vector<POD::Extended::McParticle> fTemp_MC_Lambda_Neg;
-    std::vector<POD::Extended::McParticle> fTemp_MC_Lambda_Pos;
+    Arena fMemory;  // -- backs the containers below, thus declared before them, and released in `EndOfEvent()`
+    std::pmr::vector<POD::Extended::PreFoundLambda> fTemp_AntiLambda{&fMemory};
+    std::pmr::vector<POD::Extended::PreFoundLambda> fTemp_Lambda{&fMemory};
+    [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> fTemp_MC_AntiLambda{&fMemory};
+    [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> fTemp_MC_AntiLambda_Neg{&fMemory};
+    [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> fTemp_MC_AntiLambda_Pos{&fMemory};
+    [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> fTemp_MC_Lambda{&fMemory};
+    [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> fTemp_MC_Lambda_Neg{&fMemory};
+    [[no_unique_address]] Mc<std::pmr::vector<POD::Extended::McParticle>> fTemp_MC_Lambda_Pos{&fMemory};
 
     // input //
 
     Schema::Events fInput;
-    std::unique_ptr<Framework::TeeTree::Reader> fReader;
+    InputStream fInputStream;
     // -- cached
     ROOT::Math::XYZPoint fPrimaryVertex;
     KF::Vertex fPrimaryVertexKF;
     double fMagneticField{0.};
+    [[no_unique_address]] Mc<McIndex> fMcIndex;
 
     // output //
 
@@ -268,6 +287,16 @@ class Verifier {
     std::unique_ptr<TH1D> fHist_CutFlow_AntiHdibaryon;
     std::unique_ptr<TH1D> fHist_CutFlow_Hdibaryon;
     std::unique_ptr<TH1D> fHist_CutFlow_MixedLambdaPair;
+    // -- counted into by the loops, then folded into the histograms above at `EndOfAnalysis()`
+    CutFlow_PreFoundLambda fCutFlow_AntiLambda;
+    CutFlow_PreFoundLambda fCutFlow_Lambda;
+    CutFlow_LambdaPair fCutFlow_AntiHdibaryon;
+    CutFlow_LambdaPair fCutFlow_Hdibaryon;
+    CutFlow_LambdaPair fCutFlow_MixedLambdaPair;
 };
 
+// -- both builds are instantiated once, in `Verifier.cxx`
+extern template class Verifier<false>;
+extern template class Verifier<true>;
+
 }  // namespace T2DS
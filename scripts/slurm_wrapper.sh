@@ -12,7 +12,14 @@
 #
 # Output:
 #   T2DS_ROOT_DIR / output / [found,verified] / PRODUCTION_NAME[_CHANNEL+MASS if any] \
-#                          / [Found,Verified]RNT_<run number><_chunk number if any>.root
+#                          / [Found,Verified]RNT_<run number><_chunk number if any><_shard<i> if -s>.root
+#   plus the metrics of each task next to its output, with the same name and extension `.json`
+#   plus a heartbeat file with extension `.heartbeat`, rewritten every minute while the task runs; e.g., to list the
+#   progress of every running task of a production: grep -H events_done <output dir>/*.heartbeat
+#
+# With `-s N`, each mc input file is split into N array tasks, each reading a balanced range of its entries via
+# `--shard i/N`. The shard outputs of a run can be merged afterwards, e.g.:
+#   hadd FoundRNT_<run number>.root FoundRNT_<run number>_shard*.root
 #
 # The submission writes a manifest, one line per array task, of the form:
 #   <full t2ds command>
@@ -34,9 +41,11 @@ slurm_time_merged="08:00:00" # data: several files merged per task
 slurm_time_single="01:00:00" # mc: one file per task
 
 print_usage() {
-    echo "usage: ./slurm_wrapper.sh [-y] find   <mc|data> <PRODUCTION PATH> <CHANNELS> <MASSES>"
-    echo "       ./slurm_wrapper.sh [-y] verify <mc|data> <PRODUCTION PATH> <CHANNELS> <MASSES>"
+    echo "usage: ./slurm_wrapper.sh [-y] [-s SHARDS] find   <mc|data> <PRODUCTION PATH> <CHANNELS> <MASSES>"
+    echo "       ./slurm_wrapper.sh [-y] [-s SHARDS] verify <mc|data> <PRODUCTION PATH> <CHANNELS> <MASSES>"
     echo "where: -y:              skip the confirmation of the executable's last modification time"
+    echo "       -s SHARDS:       split each mc input file into SHARDS tasks (default: 1), e.g. when they don't fit"
+    echo "                        into \`slurm_time_single\`; not used in \`data\`"
     echo "       PRODUCTION PATH: (see input layout description in script file (head -20))"
     echo "       CHANNELS:        comma-separated reaction channels (e.g. \"A,D\"), or \"\" for none"
     echo "                        - only selects input dirs, every channel is always searched within a single task"
@@ -51,9 +60,11 @@ print_usage() {
 
 # command-line arguments (1)
 skip_bin_confirmation=0
-while getopts ":y" opt; do
+n_shards=1
+while getopts ":ys:" opt; do
     case ${opt} in
         y) skip_bin_confirmation=1 ;;
+        s) n_shards=${OPTARG} ;;
         *) print_usage; exit 1 ;;
     esac
 done
@@ -61,6 +72,7 @@ shift $((OPTIND - 1))
 
 # command-line arguments (2)
 if [[ $# -ne 5 ]]; then print_usage; exit 1; fi
+if ! [[ ${n_shards} =~ ^[1-9][0-9]*$ ]]; then print_usage; exit 1; fi
 mode=$1
 if [[ ${mode} != "find" && ${mode} != "verify" ]]; then print_usage; exit 1; fi
 data_type=$2
@@ -163,11 +175,13 @@ for reaction_channel in "${reaction_channels[@]}"; do
                     if [[ ${#input_files[@]} -gt ${chunk_size} ]]; then
                         output_id="${run_number}_${chunk}"
                     fi
+                    # (open each file in the background while the previous one is processed)
                     {
-                        printf '%q -i ' "${T2DS_BIN}"
+                        printf '%q --pre-open -i ' "${T2DS_BIN}"
                         printf '%q ' "${input_files[@]:${offset}:${chunk_size}}"
-                        printf -- '-o %q %s %s %s\n' \
-                            "${output_dir}/${stage^}RNT_${output_id}.root" "${mode}" "${data_type}" "${t2ds_options}"
+                        printf -- '-o %q --metrics %q --heartbeat %q %s %s %s\n' \
+                            "${output_dir}/${stage^}RNT_${output_id}.root" "${output_dir}/${stage^}RNT_${output_id}.json" \
+                            "${output_dir}/${stage^}RNT_${output_id}.heartbeat" "${mode}" "${data_type}" "${t2ds_options}"
                     } >> "${MANIFEST}"
                     offset=$((offset + chunk_size))
                     chunk=$((chunk + 1))
@@ -178,13 +192,23 @@ for reaction_channel in "${reaction_channels[@]}"; do
             # (find mc, verify mc)
             input_files=("${input_dir}"/AnalysisResults_*.root)
 
+            # (split into `n_shards` tasks per file, if requested)
             for input_file in "${input_files[@]}"; do
-                output_id=$(basename "${input_file}" .root)
-                output_id=${output_id#*_} # remove prefix
-                printf '%q -i %q -o %q %s %s %s\n' \
-                    "${T2DS_BIN}" "${input_file}" \
-                    "${output_dir}/${stage^}RNT_${output_id}.root" "${mode}" "${data_type}" "${t2ds_options}" \
-                    >> "${MANIFEST}"
+                run_id=$(basename "${input_file}" .root)
+                run_id=${run_id#*_} # remove prefix
+                for ((shard = 0; shard < n_shards; shard++)); do
+                    output_id="${run_id}"
+                    shard_option=""
+                    if [[ ${n_shards} -gt 1 ]]; then
+                        output_id="${run_id}_shard${shard}"
+                        shard_option="--shard ${shard}/${n_shards}"
+                    fi
+                    printf '%q -i %q %s -o %q --metrics %q --heartbeat %q %s %s %s\n' \
+                        "${T2DS_BIN}" "${input_file}" "${shard_option}" \
+                        "${output_dir}/${stage^}RNT_${output_id}.root" "${output_dir}/${stage^}RNT_${output_id}.json" \
+                        "${output_dir}/${stage^}RNT_${output_id}.heartbeat" "${mode}" "${data_type}" "${t2ds_options}" \
+                        >> "${MANIFEST}"
+                done
             done
         fi
     done
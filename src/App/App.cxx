@@ -1,9 +1,71 @@
+#include <chrono>
+
 #include "App/App.hxx"
+#include "App/Arena.hxx"
+#include "App/CrossCheck.hxx"
+#include "App/Logger.hxx"
+#include "App/Metrics.hxx"
 #include "App/Parser.hxx"
+#include "App/Progress.hxx"
 #include "App/Settings.hxx"
+#include "App/Timers.hxx"
 #include "Finder/Finder.hxx"
 #include "Verifier/Verifier.hxx"
 
+namespace {
+
+// End-of-job reports, once every thread is idle, see `PerThread.hxx`.
+bool Finish(const T2DS::Settings &settings, std::chrono::steady_clock::time_point start_time) {
+    T2DS::Progress::Stop();
+    if (settings.Timers) T2DS::Timers::Report();
+    if (settings.ArenaReport) T2DS::Arena::Report();
+    bool ok = settings.PathMetricsFile.empty() || T2DS::Metrics::Write(settings, std::chrono::steady_clock::now() - start_time);
+    if (settings.CrossCheck) ok = T2DS::CrossCheck::Report() && ok;
+    Logger::StopAsync();
+    return ok;
+}
+
+// Finder and verifier are built for either data or MC -- chosen here, once, so that the data build carries no MC at all.
+template <bool IsMC>
+bool RunFinder(const T2DS::Settings &settings) {
+    using Finder = T2DS::Finder<IsMC>;
+    if (settings.Pipeline) {
+        using EventState = typename Finder::EventState;
+        return T2DS::RunOverInputsPipelined<Finder>(
+            settings,
+            [](Finder &fndr, EventState &ev) {
+                fndr.ProcessEvent(ev);
+                if constexpr (IsMC) fndr.ProcessInjected(ev);
+                fndr.ProcessTracks(ev);
+            },
+            [](Finder &fndr, EventState &ev) { fndr.FindV0s(ev); },
+            [](Finder &fndr, EventState &ev) { fndr.FindSexaquarks(ev); },
+            [](Finder &fndr, EventState &ev) { fndr.EndOfEvent(ev); });
+    }
+    return T2DS::Run<Finder>(settings, [](Finder &fndr) {
+        fndr.ProcessEvent();
+        if constexpr (IsMC) fndr.ProcessInjected();
+        fndr.ProcessTracks();
+        fndr.FindV0s();
+        fndr.FindSexaquarks();
+        fndr.EndOfEvent();
+    });
+}
+
+template <bool IsMC>
+bool RunVerifier(const T2DS::Settings &settings) {
+    using Verifier = T2DS::Verifier<IsMC>;
+    return T2DS::Run<Verifier>(settings, [](Verifier &vrfr) {
+        vrfr.ProcessEvent();
+        if constexpr (IsMC) vrfr.ProcessInjected();
+        vrfr.ProcessPreFoundLambda();
+        vrfr.Verify();
+        vrfr.EndOfEvent();
+    });
+}
+
+}  // namespace
+
 int main(int argc, char *argv[]) {
 
     T2DS::Settings settings;
@@ -11,32 +73,27 @@ int main(int argc, char *argv[]) {
     parser.Parse(argc, argv);
     if (parser.HelpOrError) return parser.ExitCode;
     parser.Assign(settings);
+    Logger::SetLevel(settings.LogLevel);
+    if (settings.AsyncLog) Logger::StartAsync();
     settings.Print();
+    if (settings.Timers) {
+        T2DS::Timers::Enable(T2DS::Timers::ELevel::All);
+    } else if (!settings.PathMetricsFile.empty()) {
+        T2DS::Timers::Enable(T2DS::Timers::ELevel::Stages);  // -- no per-call timers in the pair loops of every production job
+    }
+    if (!settings.PathMetricsFile.empty()) T2DS::Metrics::Enable(settings.PathInputFiles.size());
+    const auto start_time = std::chrono::steady_clock::now();
+    T2DS::Progress::Start(settings);
 
     switch (settings.Mode) {
         case (T2DS::EProgramMode::FINDER): {
-            T2DS::Finder fndr(settings);
-            T2DS::RunOverInputs(fndr, settings, [&] {
-                fndr.ProcessEvent();
-                if (settings.IsMC) fndr.ProcessInjected();
-                fndr.ProcessTracks();
-                fndr.FindV0s();
-                fndr.FindSexaquarks();
-                fndr.EndOfEvent();
-            });
-            if (!fndr.EndOfAnalysis()) return 1;
+            const bool ok = settings.IsMC ? RunFinder<true>(settings) : RunFinder<false>(settings);
+            if (!Finish(settings, start_time) || !ok) return 1;
             break;
         }
         case (T2DS::EProgramMode::VERIFIER): {
-            T2DS::Verifier vrfr(settings);
-            T2DS::RunOverInputs(vrfr, settings, [&] {
-                vrfr.ProcessEvent();
-                if (settings.IsMC) vrfr.ProcessInjected();
-                vrfr.ProcessPreFoundLambda();
-                vrfr.Verify();
-                vrfr.EndOfEvent();
-            });
-            if (!vrfr.EndOfAnalysis()) return 1;
+            const bool ok = settings.IsMC ? RunVerifier<true>(settings) : RunVerifier<false>(settings);
+            if (!Finish(settings, start_time) || !ok) return 1;
             break;
         }
     }
@@ -0,0 +1,110 @@
+#include <exception>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "common/Framework_TeeTree.hpp"
+#include "common/Schema_Events.hpp"
+
+#include "App/AsyncWorker.hxx"
+#include "App/Logger.hxx"
+
+#include "App/InputStream.hxx"
+
+namespace T2DS {
+
+InputStream::InputStream(ReaderFactory make_reader, bool read_ahead, bool pre_open)
+    : fMakeReader{std::move(make_reader)},
+      fSlots{},
+      fPreOpenedPath{std::nullopt},
+      fReadAheadThread{read_ahead ? std::make_unique<AsyncWorker>() : nullptr},
+      fPreOpenThread{pre_open ? std::make_unique<AsyncWorker>() : nullptr} {}
+
+bool InputStream::Open(std::string_view path) {
+    // nothing may be reading from the previous file, nor still opening the next one
+    if (fReadAheadThread) fReadAheadThread->Wait();
+    if (fPreOpenThread) fPreOpenThread->Wait();
+
+    auto &current = fSlots[fActive];
+    auto &next = fSlots[1 - fActive];
+
+    current.reader.reset();  // raw `TTree*` must die first
+    current.read_ahead_entry.reset();
+
+    // -- take over the pre-opened file, if it's the requested one
+    if (fPreOpenedPath == path) {
+        fPreOpenedPath.reset();
+        fActive = 1 - fActive;
+        if (!next.reader) {
+            Logger::Error(__FUNCTION__, "Couldn't read {} ({}) -- skipping it.", path, fPreOpenError);
+            return false;
+        }
+        return true;
+    }
+    fPreOpenedPath.reset();
+    next.reader.reset();
+    next.read_ahead_entry.reset();
+
+    try {
+        current.reader = fMakeReader(current.staging, path);
+    } catch (const std::exception &exc) {
+        Logger::Error(__FUNCTION__, "Couldn't read {} ({}) -- skipping it.", path, exc.what());
+        return false;
+    }
+    return true;
+}
+
+// Start opening `path` in the background, and read entry `first_entry` -- the first one that will be loaded from it,
+// if it has that many. No-op if pre-open is disabled.
+// The next call to `Open` takes it over if it requests the same path; failures are only reported then, and don't
+// affect the files pre-opened afterwards.
+void InputStream::PreOpen(std::string_view path, long long first_entry) {
+    if (!fPreOpenThread) return;
+    fPreOpenThread->Wait();
+
+    auto &next = fSlots[1 - fActive];
+    next.reader.reset();
+    next.read_ahead_entry.reset();
+    fPreOpenedPath = std::string(path);
+    fPreOpenError.clear();
+
+    fPreOpenThread->Submit([this, &next, path_str = std::string(path), first_entry] {
+        try {
+            next.reader = fMakeReader(next.staging, path_str);
+            if (first_entry < next.reader->GetEntries()) {
+                next.reader->Load(first_entry);
+                next.read_ahead_entry = first_entry;
+            }
+        } catch (const std::exception &exc) {
+            next.reader.reset();
+            fPreOpenError = exc.what();
+        }
+    });
+}
+
+unsigned long InputStream::GetEntries() {
+    return static_cast<unsigned long>(fSlots[fActive].reader->GetEntries());
+}
+
+// Bring entry `entry_idx` into `into`, waiting for the read-ahead if it was already requested.
+void InputStream::Load(long long entry_idx, Schema::Events &into) {
+    if (fReadAheadThread) fReadAheadThread->Wait();
+
+    auto &current = fSlots[fActive];
+    if (current.read_ahead_entry != entry_idx) current.reader->Load(entry_idx);
+    current.read_ahead_entry.reset();
+
+    std::swap(into, current.staging);
+}
+
+// Start reading entry `entry_idx` in the background. No-op if read-ahead is disabled.
+void InputStream::ReadAhead(long long entry_idx) {
+    if (!fReadAheadThread) return;
+
+    auto &current = fSlots[fActive];
+    current.read_ahead_entry = entry_idx;
+    fReadAheadThread->Submit([&current, entry_idx] { current.reader->Load(entry_idx); });
+}
+
+}  // namespace T2DS
@@ -0,0 +1,117 @@
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+#include <print>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "App/Logger.hxx"
+
+namespace Logger {
+
+namespace {
+
+constexpr std::size_t kRingSize = 4096;  // lines
+
+struct Line {
+    std::FILE *stream{nullptr};
+    std::string text;
+};
+
+void Print(std::FILE *stream, const std::string &text) { std::println(stream, "{}", text); }
+
+class AsyncSink {
+   public:
+    AsyncSink(const AsyncSink &) = delete;
+    AsyncSink(AsyncSink &&) = delete;
+    AsyncSink &operator=(const AsyncSink &) = delete;
+    AsyncSink &operator=(AsyncSink &&) = delete;
+
+    AsyncSink() = default;
+    ~AsyncSink() { Stop(); }  // -- whatever is still in the ring gets printed at exit
+
+    void Start() {
+        std::lock_guard lock(fMutex);
+        if (fThread.joinable()) return;
+        fStopping = false;
+        fRing.resize(kRingSize);
+        fThread = std::thread([this] { Flush(); });
+        fRunning.store(true, std::memory_order_release);
+    }
+
+    void Stop() {
+        {
+            std::lock_guard lock(fMutex);
+            if (!fThread.joinable()) return;
+            fStopping = true;
+            fRunning.store(false, std::memory_order_release);
+        }
+        fNotEmpty.notify_one();
+        fThread.join();
+    }
+
+    // Returns false if the sink isn't running, so that the caller prints the line itself.
+    bool Push(std::FILE *stream, std::string &&text) {
+        if (!fRunning.load(std::memory_order_acquire)) return false;
+        std::unique_lock lock(fMutex);
+        if (fStopping) return false;
+        fNotFull.wait(lock, [this] { return fSize < fRing.size(); });
+        fRing[(fHead + fSize) % fRing.size()] = Line{stream, std::move(text)};
+        ++fSize;
+        lock.unlock();
+        fNotEmpty.notify_one();
+        return true;
+    }
+
+   private:
+    // Background thread: take every pending line at once, then print them without holding the lock.
+    void Flush() {
+        std::vector<Line> batch;
+        batch.reserve(kRingSize);
+        while (true) {
+            {
+                std::unique_lock lock(fMutex);
+                fNotEmpty.wait(lock, [this] { return fSize > 0 || fStopping; });
+                if (fSize == 0) return;  // -- stopping, and drained
+                for (; fSize > 0; --fSize) {
+                    batch.push_back(std::move(fRing[fHead]));
+                    fHead = (fHead + 1) % fRing.size();
+                }
+            }
+            fNotFull.notify_all();
+            for (const auto &line : batch) Print(line.stream, line.text);
+            std::fflush(stdout);
+            std::fflush(stderr);
+            batch.clear();
+        }
+    }
+
+    std::mutex fMutex;
+    std::condition_variable fNotEmpty;
+    std::condition_variable fNotFull;
+    std::vector<Line> fRing;
+    std::size_t fHead{0};
+    std::size_t fSize{0};
+    bool fStopping{false};
+    std::atomic<bool> fRunning{false};
+    std::thread fThread;
+};
+
+AsyncSink gSink;
+
+}  // namespace
+
+void StartAsync() { gSink.Start(); }
+
+void StopAsync() { gSink.Stop(); }
+
+void Write(std::FILE *stream, std::string &&line) {
+    if (gSink.Push(stream, std::move(line))) return;
+    Print(stream, line);
+}
+
+}  // namespace Logger
@@ -0,0 +1,158 @@
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include "App/Logger.hxx"
+#include "App/PerThread.hxx"
+#include "App/Settings.hxx"
+#include "App/Timers.hxx"
+
+#include "App/Metrics.hxx"
+
+namespace T2DS::Metrics {
+
+namespace {
+
+struct CutCounts {
+    std::uint64_t in{0};
+    std::uint64_t out{0};
+};
+
+using ThreadCuts = std::array<std::array<CutCounts, static_cast<std::size_t>(EStep::kNSteps)>, static_cast<std::size_t>(ESelection::kNSelections)>;
+PerThread<ThreadCuts> gCuts;
+
+std::mutex gEventsMutex;
+std::vector<std::uint64_t> gEventsPerFile;
+
+std::string Quoted(std::string_view str) {
+    std::string quoted = "\"";
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+            quoted += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            quoted += std::format("\\u{:04x}", static_cast<unsigned int>(c));
+        } else {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+double ToSeconds(const timeval &tv) { return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) * 1E-6; }
+
+}  // namespace
+
+void Enable(std::size_t n_input_files) {
+    gEventsPerFile.assign(n_input_files, 0);
+    gEnabled.store(true, std::memory_order_relaxed);
+}
+
+void RecordCut(ESelection selection, EStep step, bool passed) {
+    CutCounts &counts = gCuts.Local()[static_cast<std::size_t>(selection)][static_cast<std::size_t>(step)];
+    ++counts.in;
+    counts.out += passed ? 1 : 0;
+}
+
+void RecordCuts(ESelection selection, EStep step, std::uint64_t n_in, std::uint64_t n_passed) {
+    CutCounts &counts = gCuts.Local()[static_cast<std::size_t>(selection)][static_cast<std::size_t>(step)];
+    counts.in += n_in;
+    counts.out += n_passed;
+}
+
+void CountEvents(std::size_t file_idx, unsigned long n_events) {
+    if (!IsEnabled()) return;
+    std::lock_guard lock(gEventsMutex);
+    gEventsPerFile[file_idx] += n_events;
+}
+
+bool Write(const Settings &settings, std::chrono::duration<double> wall_time) {
+
+    // -- whole process
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    const double cpu_time = ToSeconds(usage.ru_utime) + ToSeconds(usage.ru_stime);
+    const long peak_rss_kb = usage.ru_maxrss;  // kilobytes, on Linux
+
+    std::uint64_t n_events = 0;
+    for (const auto n : gEventsPerFile) n_events += n;
+
+    ThreadCuts cuts{};
+    gCuts.ForEach([&](const ThreadCuts &thread_cuts) {
+        for (std::size_t i = 0; i < cuts.size(); ++i) {
+            for (std::size_t j = 0; j < cuts[i].size(); ++j) {
+                cuts[i][j].in += thread_cuts[i][j].in;
+                cuts[i][j].out += thread_cuts[i][j].out;
+            }
+        }
+    });
+
+    std::string json = "{\n";
+    json += std::format("  \"mode\": {},\n", Quoted(Name_ProgramMode[settings.Mode]));
+    json += std::format("  \"is_mc\": {},\n", settings.IsMC);
+    json += std::format("  \"output\": {},\n", Quoted(settings.PathOutputFile));
+    json += std::format("  \"events\": {},\n", n_events);
+    json += std::format("  \"wall_time_s\": {:.3f},\n", wall_time.count());
+    json += std::format("  \"cpu_time_s\": {:.3f},\n", cpu_time);
+    json += std::format("  \"events_per_s\": {:.3f},\n", wall_time.count() > 0. ? static_cast<double>(n_events) / wall_time.count() : 0.);
+    json += std::format("  \"peak_rss_kb\": {},\n", peak_rss_kb);
+
+    // -- events per input file
+    json += "  \"inputs\": [";
+    for (std::size_t file_idx = 0; file_idx < gEventsPerFile.size(); ++file_idx) {
+        json += std::format("{}\n    {{\"path\": {}, \"events\": {}}}", file_idx == 0 ? "" : ",", Quoted(settings.PathInputFiles[file_idx]),
+                            gEventsPerFile[file_idx]);
+    }
+    json += "\n  ],\n";
+
+    // -- stages, as measured by the timers -- CPU time only with `--timers`, which also adds the per-call timers
+    json += "  \"stages\": {";
+    bool first = true;
+    const bool with_cpu = Timers::Level() == Timers::ELevel::All;
+    for (const auto &stage : Timers::Summarize()) {
+        json += std::format(
+            "{}\n    {}: {{\"calls\": {}, \"wall_s\": {:.6f}, {}\"mean_us\": {:.3f}, \"p50_us\": {:.3f}, \"p90_us\": {:.3f}, "
+            "\"p99_us\": {:.3f}, \"max_us\": {:.3f}}}",
+            first ? "" : ",", Quoted(stage.name), stage.calls, stage.wall_s, with_cpu ? std::format("\"cpu_s\": {:.6f}, ", stage.cpu_s) : "",
+            stage.mean_us, stage.p50_us, stage.p90_us, stage.p99_us, stage.max_us);
+        first = false;
+    }
+    json += "\n  },\n";
+
+    // -- pairs entering and leaving each cut step, and the resulting candidates
+    std::string json_cuts;
+    std::string json_candidates;
+    for (std::size_t i = 0; i < cuts.size(); ++i) {
+        const auto &seed = cuts[i][static_cast<std::size_t>(EStep::PostSeedCuts)];
+        const auto &fit = cuts[i][static_cast<std::size_t>(EStep::PostFitCuts)];
+        if (seed.in == 0 && fit.in == 0) continue;
+        json_cuts += std::format("{}\n    {}: {{\"{}\": {{\"in\": {}, \"out\": {}}}, \"{}\": {{\"in\": {}, \"out\": {}}}}}",
+                                 json_cuts.empty() ? "" : ",", Quoted(Name_Selection[i]),  //
+                                 Name_Step[0], seed.in, seed.out, Name_Step[1], fit.in, fit.out);
+        if (fit.in == 0) continue;
+        json_candidates += std::format("{}\n    {}: {}", json_candidates.empty() ? "" : ",", Quoted(Name_Selection[i]), fit.out);
+    }
+    json += std::format("  \"cuts\": {{{}\n  }},\n", json_cuts);
+    json += std::format("  \"candidates\": {{{}\n  }}\n", json_candidates);
+    json += "}\n";
+
+    std::ofstream file(settings.PathMetricsFile);
+    file << json;
+    if (!file.good()) {
+        Logger::Error(__FUNCTION__, "Couldn't write metrics into {}.", settings.PathMetricsFile);
+        return false;
+    }
+    Logger::Info(__FUNCTION__, "Metrics written into {}.", settings.PathMetricsFile);
+    return true;
+}
+
+}  // namespace T2DS::Metrics
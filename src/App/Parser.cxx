@@ -1,18 +1,48 @@
+#include <cstddef>
+#include <charconv>
 #include <format>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <CLI/CLI.hpp>
 
+#include "App/Logger.hxx"
 #include "App/Parser.hxx"
 #include "App/Settings.hxx"
 
 namespace T2DS {
 
+namespace {
+
+// Parse `--shard i/N` into `{i, N}`, with `0 <= i < N`.
+std::optional<std::pair<unsigned int, unsigned int>> ParseShard(std::string_view str) {
+    const auto slash = str.find('/');
+    if (slash == std::string_view::npos) return std::nullopt;
+    unsigned int index = 0;
+    unsigned int n_shards = 0;
+    const auto [end_index, error_index] = std::from_chars(str.data(), str.data() + slash, index);
+    const auto [end_n, error_n] = std::from_chars(str.data() + slash + 1, str.data() + str.size(), n_shards);
+    if (error_index != std::errc{} || end_index != str.data() + slash) return std::nullopt;
+    if (error_n != std::errc{} || end_n != str.data() + str.size()) return std::nullopt;
+    if (index >= n_shards) return std::nullopt;
+    return std::pair{index, n_shards};
+}
+
+}  // namespace
+
 int Parser::Parse(int argc, char* argv[]) {
     argv = CLI_APP.ensure_utf8(argv);
     try {
         CLI_APP.parse(argc, argv);
+        auto* opt_first = CLI_APP.get_option("--first-event");
+        auto* opt_last = CLI_APP.get_option("--last-event");
+        if (opt_first->count() > 0 && opt_last->count() > 0 && opt_last->as<unsigned long>() < opt_first->as<unsigned long>()) {
+            throw CLI::ValidationError("--last-event", "can't be smaller than --first-event");
+        }
     } catch (const CLI::ParseError& e) {
         ExitCode = e.get_exit_code();
         HelpOrError = (e.get_name() == "CallForHelp") || (ExitCode != 0);
@@ -45,6 +75,79 @@ void Parser::Assign(Settings& settings) {
         settings.LimitToNEvents = opt_n->as<long long>();
     }
 
+    // -- event range
+    auto* opt_first = CLI_APP.get_option("--first-event");
+    if (opt_first->count() > 0) {
+        settings.FirstEvent = opt_first->as<unsigned long>();
+    }
+    auto* opt_last = CLI_APP.get_option("--last-event");
+    if (opt_last->count() > 0) {
+        settings.LastEvent = opt_last->as<unsigned long>();
+    }
+    auto* opt_shard = CLI_APP.get_option("--shard");
+    if (opt_shard->count() > 0) {
+        std::tie(settings.ShardIndex, settings.NShards) = ParseShard(opt_shard->as<std::string>()).value();
+    }
+
+    // -- threads
+    auto* opt_j = CLI_APP.get_option("-j");
+    if (opt_j->count() > 0) {
+        settings.NThreads = opt_j->as<unsigned int>();
+    }
+
+    // -- intra-event tasks
+    auto* opt_tasks = CLI_APP.get_option("--tasks");
+    if (opt_tasks->count() > 0) {
+        settings.NTasks = opt_tasks->as<unsigned int>();
+    }
+
+    // -- asynchronous i/o
+    settings.ReadAhead = CLI_APP.get_option("--read-ahead")->count() > 0;
+    settings.PreOpen = CLI_APP.get_option("--pre-open")->count() > 0;
+
+    // -- pipelined stages
+    settings.Pipeline = CLI_APP.get_option("--pipeline")->count() > 0;
+
+    // -- combinatorics
+    settings.PairGrid = CLI_APP.get_option("--pair-grid")->count() > 0;
+    auto* opt_seeding_precision = CLI_APP.get_option("--seeding-precision");
+    if (opt_seeding_precision->count() > 0) {
+        const auto precision = opt_seeding_precision->as<std::string>();
+        for (std::size_t i = 0; i < Name_SeedingPrecision.size(); ++i) {
+            if (precision == Name_SeedingPrecision[i]) settings.SeedingPrecision = static_cast<ESeedingPrecision>(i);
+        }
+    }
+    settings.CrossCheck = CLI_APP.get_option("--cross-check")->count() > 0;
+
+    // -- instrumentation
+    settings.Timers = CLI_APP.get_option("--timers")->count() > 0;
+    settings.ArenaReport = CLI_APP.get_option("--arena-report")->count() > 0;
+    auto* opt_metrics = CLI_APP.get_option("--metrics");
+    if (opt_metrics->count() > 0) {
+        settings.PathMetricsFile = opt_metrics->as<std::string>();
+    }
+
+    // -- progress
+    auto* opt_progress = CLI_APP.get_option("--progress");
+    if (opt_progress->count() > 0) {
+        settings.ProgressInterval = opt_progress->as<unsigned int>();
+    }
+    auto* opt_heartbeat = CLI_APP.get_option("--heartbeat");
+    if (opt_heartbeat->count() > 0) {
+        settings.PathHeartbeatFile = opt_heartbeat->as<std::string>();
+        if (settings.ProgressInterval == 0) settings.ProgressInterval = DefaultProgressInterval;
+    }
+
+    // -- logging
+    auto* opt_log_level = CLI_APP.get_option("--log-level");
+    if (opt_log_level->count() > 0) {
+        const auto level = opt_log_level->as<std::string>();
+        for (std::size_t i = 0; i < Logger::Name_Level.size(); ++i) {
+            if (level == Logger::Name_Level[i]) settings.LogLevel = static_cast<Logger::ELevel>(i);
+        }
+    }
+    settings.AsyncLog = CLI_APP.get_option("--async-log")->count() > 0;
+
     // -- injected mass
     if (settings.Mode == EProgramMode::FINDER && settings.IsMC) {
         settings.SexaquarkMass = data_kind_cmd->get_option("-m")->as<double>();
@@ -71,6 +174,37 @@ void Parser::AddOptions() {
     CLI_APP.add_option("-i,--input", InputFiles, "Path(s) of input file(s)")->required();
     CLI_APP.add_option("-o,--output", "Path of output file")->expected(1);
     CLI_APP.add_option("-n,--nevents", "Limit to N events")->expected(1)->check(CLI::PositiveNumber);
+    auto* opt_first = CLI_APP.add_option("--first-event", "Global number of the first entry to read")->expected(1)->check(CLI::NonNegativeNumber);
+    auto* opt_last = CLI_APP.add_option("--last-event", "Global number of the last entry to read")->expected(1)->check(CLI::NonNegativeNumber);
+    CLI_APP.add_option("--shard", "Read only the i-th of N balanced ranges of entries, as i/N")
+        ->expected(1)
+        ->check(CLI::Validator(
+            [](const std::string& str) { return ParseShard(str).has_value() ? std::string{} : std::string{"expected i/N, with 0 <= i < N"}; },
+            "i/N"))
+        ->excludes(opt_first)
+        ->excludes(opt_last);
+    auto* opt_threads = CLI_APP.add_option("-j,--threads", "Number of event-parallel threads")->expected(1)->check(CLI::PositiveNumber);
+    CLI_APP.add_option("--tasks", "Number of threads sharing the combinatorics of each event")
+        ->expected(1)
+        ->check(CLI::PositiveNumber)
+        ->excludes(opt_threads);
+    CLI_APP.add_flag("--read-ahead", "Read the next event in the background while processing the current one");
+    CLI_APP.add_flag("--pre-open", "Open the next input file in the background while processing the current one");
+    CLI_APP.add_flag("--pipeline", "Run the stages of the finder on separate threads, with several events in flight")->excludes(opt_threads);
+    CLI_APP.add_flag("--pair-grid", "Pair tracks into V0s through a spatial grid, instead of trying every pair");
+    CLI_APP.add_option("--seeding-precision", "Precision of the batched first phase of seeding V0s")
+        ->expected(1)
+        ->check(CLI::IsMember(std::vector<std::string>(Name_SeedingPrecision.begin(), Name_SeedingPrecision.end())));
+    CLI_APP.add_flag("--cross-check", "Run the exhaustive path next to every enabled fast path, and report their differences");
+    CLI_APP.add_flag("--timers", "Time every stage and print a summary at the end");
+    CLI_APP.add_flag("--arena-report", "Print the high-water mark of the per-event memory at the end");
+    CLI_APP.add_option("--metrics", "Path of a JSON file to write the metrics of the job into")->expected(1);
+    CLI_APP.add_option("--progress", "Report the progress of the job to stderr every N seconds")->expected(1)->check(CLI::NonNegativeNumber);
+    CLI_APP.add_option("--heartbeat", "Path of a file to keep updated with the progress of the job")->expected(1);
+    CLI_APP.add_option("--log-level", "Lowest level of the messages to print")
+        ->expected(1)
+        ->check(CLI::IsMember(std::vector<std::string>(Logger::Name_Level.begin(), Logger::Name_Level.end())));
+    CLI_APP.add_flag("--async-log", "Print messages from a background thread");
 
     auto add_mass_opt = [](CLI::App* subcmd) {
         subcmd
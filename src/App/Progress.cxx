@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "App/Logger.hxx"
+#include "App/Settings.hxx"
+
+#include "App/Progress.hxx"
+
+namespace T2DS::Progress {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct State {
+    std::mutex mutex;
+    // -- inputs, updated whenever a file is opened
+    std::vector<std::string> input_paths;
+    std::size_t n_files{0};
+    std::optional<std::size_t> current_file_idx;
+    std::string current_file;
+    std::uint64_t events_in_opened_files{0};
+    std::size_t n_opened_files{0};
+    std::optional<std::uint64_t> limit;
+    std::optional<std::uint64_t> exact_total;
+    // -- reporting
+    std::string heartbeat_path;
+    std::chrono::seconds interval{0};
+    Clock::time_point start;
+    Clock::time_point last_report;
+    std::uint64_t events_at_last_report{0};
+};
+
+State gState;
+std::condition_variable_any gWakeUp;
+std::optional<std::jthread> gThread;
+
+// Expected number of events, and whether it's exact or extrapolated from the files opened so far.
+// The caller must hold the mutex.
+std::pair<std::uint64_t, bool> EstimateTotal() {
+    if (gState.exact_total.has_value()) return {gState.exact_total.value(), true};
+
+    const std::size_t n_files_left = gState.current_file_idx.has_value() ? gState.n_files - gState.current_file_idx.value() - 1 : gState.n_files;
+    const std::uint64_t mean_per_file = gState.n_opened_files > 0 ? gState.events_in_opened_files / gState.n_opened_files : 0;
+    const std::uint64_t extrapolated = gState.events_in_opened_files + mean_per_file * n_files_left;
+    const bool all_opened = n_files_left == 0;
+
+    // -- once every file was opened, the counts are already clamped to `-n`
+    if (!all_opened && gState.limit.has_value() && extrapolated >= gState.limit.value()) return {gState.limit.value(), true};
+    return {extrapolated, all_opened};
+}
+
+std::string FormatDuration(double seconds) {
+    const auto total = static_cast<long long>(seconds);
+    return std::format("{:02}:{:02}:{:02}", total / 3600, (total / 60) % 60, total % 60);
+}
+
+void Report(bool final_report) {
+    std::lock_guard lock(gState.mutex);
+
+    const auto now = Clock::now();
+    const std::uint64_t done = gEventsDone.load(std::memory_order_relaxed);
+    const double elapsed = std::chrono::duration<double>(now - gState.start).count();
+    const double since_last = std::chrono::duration<double>(now - gState.last_report).count();
+    const double rate_avg = elapsed > 0. ? static_cast<double>(done) / elapsed : 0.;
+    const double rate_now = since_last > 0. ? static_cast<double>(done - gState.events_at_last_report) / since_last : 0.;
+    gState.last_report = now;
+    gState.events_at_last_report = done;
+
+    const auto [total, exact] = EstimateTotal();
+    const double fraction = total > 0 ? static_cast<double>(done) / static_cast<double>(total) : 0.;
+    std::optional<double> eta;
+    if (rate_avg > 0. && total >= done) eta = static_cast<double>(total - done) / rate_avg;
+    const std::string file_idx = gState.current_file_idx.has_value() ? std::format("{}", gState.current_file_idx.value() + 1) : "-";
+
+    Logger::Status("Progress", "{}{}/{}{} events ({:.1f}%) :: {:.2f} ev/s now, {:.2f} ev/s avg :: elapsed {} :: ETA {} :: file {}/{} {}",
+                   final_report ? "done :: " : "", done, exact ? "" : "~", total, 100. * fraction, rate_now, rate_avg, FormatDuration(elapsed),
+                   eta.has_value() ? FormatDuration(eta.value()) : "--:--:--", file_idx, gState.n_files, gState.current_file);
+
+    if (gState.heartbeat_path.empty()) return;
+
+    // -- written aside and renamed, so that a reader never sees a half-written file
+    const std::string tmp_path = gState.heartbeat_path + ".tmp";
+    {
+        std::ofstream heartbeat(tmp_path, std::ios::trunc);
+        heartbeat << std::format("state={}\n", final_report ? "done" : "running");
+        heartbeat << std::format("unix_time={}\n", static_cast<long long>(std::time(nullptr)));
+        heartbeat << std::format("elapsed_s={:.0f}\n", elapsed);
+        heartbeat << std::format("events_done={}\n", done);
+        heartbeat << std::format("events_total={}\n", total);
+        heartbeat << std::format("events_total_exact={}\n", exact ? 1 : 0);
+        heartbeat << std::format("events_per_s_now={:.3f}\n", rate_now);
+        heartbeat << std::format("events_per_s_avg={:.3f}\n", rate_avg);
+        heartbeat << std::format("eta_s={}\n", eta.has_value() ? std::format("{:.0f}", eta.value()) : "");
+        heartbeat << std::format("file_idx={}\n", file_idx);
+        heartbeat << std::format("file={}\n", gState.current_file);
+    }
+    std::error_code error;
+    std::filesystem::rename(tmp_path, gState.heartbeat_path, error);
+    if (error) Logger::Warning("Progress", "Couldn't update heartbeat file {} ({}).", gState.heartbeat_path, error.message());
+}
+
+}  // namespace
+
+void Start(const Settings &settings) {
+    {
+        std::lock_guard lock(gState.mutex);
+        gState.input_paths = settings.PathInputFiles;
+        gState.n_files = settings.PathInputFiles.size();
+        if (settings.LimitToNEvents.has_value()) gState.limit = settings.LimitToNEvents.value();
+        if (settings.LastEvent.has_value()) {
+            const std::uint64_t n_selected = settings.LastEvent.value() + 1 - settings.FirstEvent.value_or(0);
+            gState.limit = std::min(gState.limit.value_or(n_selected), n_selected);
+        }
+        gState.heartbeat_path = settings.PathHeartbeatFile;
+        gState.interval = std::chrono::seconds{settings.ProgressInterval};
+        gState.start = Clock::now();
+        gState.last_report = gState.start;
+    }
+    if (gState.interval.count() == 0) return;
+
+    gThread.emplace([](std::stop_token stop) {
+        std::mutex mutex;
+        std::unique_lock lock(mutex);
+        while (!gWakeUp.wait_for(lock, stop, gState.interval, [] { return false; })) {
+            if (stop.stop_requested()) return;
+            Report(false);
+        }
+    });
+}
+
+void Stop() {
+    if (!gThread.has_value()) return;
+    gThread->request_stop();  // -- wakes it up through `gWakeUp`
+    gThread.reset();
+    Report(true);
+}
+
+void OpenedFile(std::size_t file_idx, unsigned long n_events) {
+    std::lock_guard lock(gState.mutex);
+    gState.current_file_idx = file_idx;
+    gState.current_file = std::filesystem::path(gState.input_paths[file_idx]).filename().string();
+    gState.events_in_opened_files += n_events;
+    ++gState.n_opened_files;
+}
+
+void SetTotal(std::uint64_t n_events) {
+    std::lock_guard lock(gState.mutex);
+    gState.exact_total = n_events;
+}
+
+}  // namespace T2DS::Progress
@@ -1,5 +1,8 @@
 #include <array>
+#include <cstddef>
+#include <format>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "App/Logger.hxx"
@@ -27,6 +30,26 @@ void Settings::Print() const {
     } else {
         Logger::Info("Settings", "LimitToNEvents  = --");
     }
+    if (FirstEvent.has_value() || LastEvent.has_value()) {
+        const std::string last = LastEvent.has_value() ? std::format("{}", LastEvent.value()) : "--";
+        Logger::Info("Settings", "EventRange      = [{}, {}]", FirstEvent.value_or(0), last);
+    }
+    if (NShards > 1) Logger::Info("Settings", "Shard           = {}/{}", ShardIndex, NShards);
+    Logger::Info("Settings", "NThreads        = {}", NThreads);
+    Logger::Info("Settings", "NTasks          = {}", NTasks);
+    Logger::Info("Settings", "ReadAhead       = {}", ReadAhead);
+    Logger::Info("Settings", "PreOpen         = {}", PreOpen);
+    Logger::Info("Settings", "Pipeline        = {}", Pipeline);
+    Logger::Info("Settings", "PairGrid        = {}", PairGrid);
+    Logger::Info("Settings", "SeedingPrecision = {}", Name_SeedingPrecision[static_cast<std::size_t>(SeedingPrecision)]);
+    Logger::Info("Settings", "CrossCheck      = {}", CrossCheck);
+    Logger::Info("Settings", "Timers          = {}", Timers);
+    Logger::Info("Settings", "ArenaReport     = {}", ArenaReport);
+    Logger::Info("Settings", "MetricsFile     = {}", PathMetricsFile.empty() ? "--" : PathMetricsFile);
+    Logger::Info("Settings", "ProgressEvery   = {}", ProgressInterval == 0 ? "--" : std::format("{} s", ProgressInterval));
+    Logger::Info("Settings", "HeartbeatFile   = {}", PathHeartbeatFile.empty() ? "--" : PathHeartbeatFile);
+    Logger::Info("Settings", "LogLevel        = {}", Logger::Name_Level[static_cast<std::size_t>(LogLevel)]);
+    Logger::Info("Settings", "AsyncLog        = {}", AsyncLog);
 }
 
 }  // namespace T2DS
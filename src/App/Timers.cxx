@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "App/Logger.hxx"
+#include "App/PerThread.hxx"
+
+#include "App/Timers.hxx"
+
+namespace T2DS::Timers {
+
+namespace {
+
+// Durations are binned on a log scale: one octave per power of two nanoseconds, split in `kSubBuckets` linear parts,
+// which bounds the error of any percentile to ~1/kSubBuckets of its value, whatever the range.
+constexpr unsigned int kSubBucketBits = 2;
+constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBucketBits;
+constexpr std::size_t kNBuckets = 64 * kSubBuckets;
+
+constexpr std::size_t BucketIndex(std::uint64_t ns) {
+    if (ns < kSubBuckets) return static_cast<std::size_t>(ns);
+    const auto octave = static_cast<unsigned int>(std::bit_width(ns)) - 1;
+    const auto sub_bucket = static_cast<std::size_t>((ns >> (octave - kSubBucketBits)) & (kSubBuckets - 1));
+    return (octave - kSubBucketBits + 1) * kSubBuckets + sub_bucket;
+}
+
+// upper edge of a bucket -- percentiles are reported conservatively
+constexpr std::uint64_t BucketUpperEdge(std::size_t bucket) {
+    if (bucket < kSubBuckets) return bucket + 1;
+    const std::size_t octave = bucket / kSubBuckets + kSubBucketBits - 1;
+    const std::uint64_t sub_bucket = bucket % kSubBuckets;
+    return (std::uint64_t{1} << octave) + ((sub_bucket + 1) << (octave - kSubBucketBits));
+}
+
+struct Stats {
+    std::uint64_t calls{0};
+    std::uint64_t total_ns{0};
+    std::uint64_t total_cpu_ns{0};
+    std::uint64_t max_ns{0};
+    std::array<std::uint64_t, kNBuckets> buckets{};
+
+    void Add(const Stats &other) {
+        calls += other.calls;
+        total_ns += other.total_ns;
+        total_cpu_ns += other.total_cpu_ns;
+        max_ns = std::max(max_ns, other.max_ns);
+        for (std::size_t i = 0; i < kNBuckets; ++i) buckets[i] += other.buckets[i];
+    }
+
+    [[nodiscard]] std::uint64_t Percentile(double fraction) const {
+        const auto rank = static_cast<std::uint64_t>(fraction * static_cast<double>(calls));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < kNBuckets; ++i) {
+            seen += buckets[i];
+            if (seen > rank) return std::min(BucketUpperEdge(i), max_ns);
+        }
+        return max_ns;
+    }
+};
+
+using ThreadStats = std::array<Stats, static_cast<std::size_t>(ETimer::kNTimers)>;
+PerThread<ThreadStats> gStats;
+
+std::uint64_t ToNanoseconds(std::chrono::nanoseconds duration) {
+    return static_cast<std::uint64_t>(std::max(duration.count(), std::chrono::nanoseconds::rep{0}));
+}
+
+double ToMicroseconds(std::uint64_t ns) { return static_cast<double>(ns) * 1E-3; }
+
+}  // namespace
+
+void Record(ETimer timer, std::chrono::nanoseconds wall, std::chrono::nanoseconds cpu) {
+    const std::uint64_t ns = ToNanoseconds(wall);
+    Stats &stats = gStats.Local()[static_cast<std::size_t>(timer)];
+    ++stats.calls;
+    stats.total_ns += ns;
+    stats.total_cpu_ns += ToNanoseconds(cpu);
+    stats.max_ns = std::max(stats.max_ns, ns);
+    ++stats.buckets[BucketIndex(ns)];
+}
+
+std::vector<Summary> Summarize() {
+    ThreadStats merged{};
+    gStats.ForEach([&](const ThreadStats &thread_stats) {
+        for (std::size_t i = 0; i < merged.size(); ++i) merged[i].Add(thread_stats[i]);
+    });
+
+    std::vector<Summary> summaries;
+    for (std::size_t i = 0; i < merged.size(); ++i) {
+        const Stats &stats = merged[i];
+        if (stats.calls == 0) continue;
+        summaries.push_back({
+            .name = Name_Timer[i],
+            .calls = stats.calls,
+            .wall_s = static_cast<double>(stats.total_ns) * 1E-9,
+            .cpu_s = static_cast<double>(stats.total_cpu_ns) * 1E-9,
+            .mean_us = ToMicroseconds(stats.total_ns) / static_cast<double>(stats.calls),
+            .p50_us = ToMicroseconds(stats.Percentile(0.50)),
+            .p90_us = ToMicroseconds(stats.Percentile(0.90)),
+            .p99_us = ToMicroseconds(stats.Percentile(0.99)),
+            .max_us = ToMicroseconds(stats.max_ns),
+        });
+    }
+    return summaries;
+}
+
+void Report() {
+    Logger::Info(__FUNCTION__, "Timers, summed over all threads (inclusive of nested timers):");
+    Logger::Info(__FUNCTION__, "{:<22} {:>12} {:>11} {:>11} {:>11} {:>11} {:>11} {:>11} {:>11}", "timer", "calls", "wall [s]", "cpu [s]", "mean [us]",
+                 "p50 [us]", "p90 [us]", "p99 [us]", "max [us]");
+    for (const auto &summary : Summarize()) {
+        Logger::Info(__FUNCTION__, "{:<22} {:>12} {:>11.3f} {:>11.3f} {:>11.2f} {:>11.2f} {:>11.2f} {:>11.2f} {:>11.2f}", summary.name, summary.calls,
+                     summary.wall_s, summary.cpu_s, summary.mean_us, summary.p50_us, summary.p90_us, summary.p99_us, summary.max_us);
+    }
+}
+
+}  // namespace T2DS::Timers
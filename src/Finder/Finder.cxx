@@ -1,8 +1,16 @@
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <format>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <optional>
+#include <span>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "common/Cached_ChannelA.hpp"
@@ -23,17 +31,23 @@ namespace CMath = Common::Math;
 
 #include "KalmanFitter/BaseKalmanFitter.hxx"
 #include "Seeder/BaseSeeder.hxx"
+#include "Seeder/PairGrid.hxx"
 #include "Seeder/SeederHelixHelix.hxx"
 #include "Seeder/SeederHelixLine.hxx"
 #include "Seeder/SeederLineLine.hxx"
 
+#include "App/CrossCheck.hxx"
+#include "App/Metrics.hxx"
+#include "App/Timers.hxx"
+
 #include "Finder/Finder.hxx"
 
 namespace T2DS {
 
 // ## OUTPUT ZONE ## //
 
-void Finder::PrepareOutputHistograms() {
+template <bool IsMC>
+void Finder<IsMC>::PrepareOutputHistograms() {
     // event counter
     fHist_EventCounter = std::make_unique<TH1D>("N_Events", ";N_Events;", 1, 0., 1.);
 
@@ -136,21 +150,39 @@ void Finder::PrepareOutputHistograms() {
     // x_axis = hist_sexa->GetXaxis();
     // PENDING
     // }
+
+    // counters, folded into the histograms at the end //
+    fCutFlow_AntiProton = CutFlow_Proton(fHist_CutFlow_AntiProton.get());
+    fCutFlow_Proton = CutFlow_Proton(fHist_CutFlow_Proton.get());
+    fCutFlow_NegKaon = CutFlow_Kaon(fHist_CutFlow_NegKaon.get());
+    fCutFlow_PosKaon = CutFlow_Kaon(fHist_CutFlow_PosKaon.get());
+    fCutFlow_PiMinus = CutFlow_Pion(fHist_CutFlow_PiMinus.get());
+    fCutFlow_PiPlus = CutFlow_Pion(fHist_CutFlow_PiPlus.get());
+    fCutFlow_AntiLambda = CutFlow_Lambda(fHist_CutFlow_AntiLambda.get());
+    fCutFlow_Lambda = CutFlow_Lambda(fHist_CutFlow_Lambda.get());
+    fCutFlow_KaonZeroShort = CutFlow_KaonZeroShort(fHist_CutFlow_KaonZeroShort.get());
+    fCutFlow_ChannelA = CutFlow_ChannelA(fHist_CutFlow_ChannelA.get());
+    fCutFlow_ChannelA_Bkg = CutFlow_ChannelA(fHist_CutFlow_ChannelA_Bkg.get());
+    fCutFlow_ChannelD = CutFlow_ChannelD(fHist_CutFlow_ChannelD.get());
+    fCutFlow_ChannelD_Bkg = CutFlow_ChannelD(fHist_CutFlow_ChannelD_Bkg.get());
+    fCutFlow_ChannelH = CutFlow_ChannelH(fHist_CutFlow_ChannelH.get());
+    fCutFlow_ChannelH_Bkg = CutFlow_ChannelH(fHist_CutFlow_ChannelH_Bkg.get());
 }
 
 // ## Event ZONE ## //
 
-void Finder::ProcessEvent() {
+template <bool IsMC>
+void Finder<IsMC>::ProcessEvent(EventState& ev) {
     // update event counter
     fHist_EventCounter->Fill(0.);
 
     // cache pv and magnetic field
-    fPrimaryVertex.SetCoordinates(fInput.Event.PV_X, fInput.Event.PV_Y, fInput.Event.PV_Z);
-    fMagneticField = fInput.Event.MagneticField;
+    ev.PrimaryVertex.SetCoordinates(ev.Input.Event.PV_X, ev.Input.Event.PV_Y, ev.Input.Event.PV_Z);
+    ev.MagneticField = ev.Input.Event.MagneticField;
 
     // copy event info into every output rntuple
-    fOutput.Event = fInput.Event;
-    if (fSettings.IsMC) fOutput.MC_Event = fInput.MC_Event;
+    ev.Output.Event = ev.Input.Event;
+    if constexpr (IsMC) ev.Output.MC_Event = ev.Input.MC_Event;
 }
 
 // ## Injected/MC ZONE ## //
@@ -158,20 +190,23 @@ void Finder::ProcessEvent() {
 // Loop over all MC particles.
 // Select particles with no mother, generated via the AntiSexaquark-Reaction Generator, and with valid Reaction IDs;
 // and store their origin vertex as the coordinates for this particular secondary vertex.
-void Finder::ProcessInjected() {
+template <bool IsMC>
+void Finder<IsMC>::ProcessInjected(EventState& ev)
+    requires IsMC
+{
 
     if (!fMcSignalChannel.has_value()) {
-        fMcSignalChannel = MC::SexaquarkRules::DetectMcSignalChannel(fInput.McParticle);
+        fMcSignalChannel = MC::SexaquarkRules::DetectMcSignalChannel(ev.Input.McParticle);
         Logger::Info(__FUNCTION__, "Injected reaction channel identified as \"Channel {}\".", fMcSignalChannel->name);
     }
 
     // there's nothing to collect; copy what is already there, if anything
     if (fMcSignalChannel->name == '0') {
-        for (const auto& input_inj : fInput.InjectedSexa) fOutput.Injected.emplace_back(POD::Extended::InjectedSexa{input_inj});
+        for (const auto& input_inj : ev.Input.InjectedSexa) ev.Output.Injected.emplace_back(POD::Extended::InjectedSexa{input_inj});
         return;
     }
 
-    const std::size_t n_injected = fInput.InjectedSexa.size();
+    const std::size_t n_injected = ev.Input.InjectedSexa.size();
     if (n_injected == 0) return;
 
     // struck nucleon mass
@@ -179,7 +214,7 @@ void Finder::ProcessInjected() {
 
     // accumulate the first-gen products of every reaction //
     std::vector<InjectedReaction> reactions(n_injected);
-    for (const auto& mc : fInput.McParticle) {
+    for (const auto& mc : ev.Input.McParticle) {
         // -- select only first-gen signal products
         if (!MC::SexaquarkRules::IsGen1Signal(mc, fMcSignalChannel.value())) continue;
         // -- derive entry
@@ -200,12 +235,12 @@ void Finder::ProcessInjected() {
     }
 
     // copy input injected sexa info //
-    fOutput.Injected.resize(n_injected);
+    ev.Output.Injected.resize(n_injected);
     for (std::size_t entry_inj = 0; entry_inj < n_injected; ++entry_inj) {
         // cache index lookups //
-        const POD::InjectedSexa& input_inj = fInput.InjectedSexa[entry_inj];
+        const POD::InjectedSexa& input_inj = ev.Input.InjectedSexa[entry_inj];
         const InjectedReaction& reaction = reactions[entry_inj];
-        POD::Extended::InjectedSexa& output_inj = fOutput.Injected[entry_inj];
+        POD::Extended::InjectedSexa& output_inj = ev.Output.Injected[entry_inj];
         // fill values //
         static_cast<POD::InjectedSexa&>(output_inj) = input_inj;
         output_inj.Energy = static_cast<float>(CMath::Hypot4(input_inj.Px, input_inj.Py, input_inj.Pz, fSettings.SexaquarkMass));
@@ -221,7 +256,11 @@ void Finder::ProcessInjected() {
     }
 }
 
-POD::Linked::InjectedSexa Finder::BuildMcSexaquark(const POD::Extended::McParticle& mc_dau1, const POD::Extended::McParticle& mc_dau2) {
+template <bool IsMC>
+POD::Linked::InjectedSexa Finder<IsMC>::BuildMcSexaquark(const EventState& ev, const POD::Extended::McParticle& mc_dau1,
+                                                         const POD::Extended::McParticle& mc_dau2)
+    requires IsMC
+{
     POD::Linked::InjectedSexa mc_sexa;
 
     // fill hybridness, independently of no common reaction id
@@ -229,183 +268,256 @@ POD::Linked::InjectedSexa Finder::BuildMcSexaquark(const POD::Extended::McPartic
 
     // find common reaction id
     auto entry_inj = MC::SexaquarkRules::FindCommonReactionID(mc_dau1, mc_dau2);
-    if (!entry_inj.has_value() || entry_inj.value() >= fOutput.Injected.size()) {
+    if (!entry_inj.has_value() || entry_inj.value() >= ev.Output.Injected.size()) {
         return mc_sexa;
     }
 
     // if found, fill it with matching injected info
-    static_cast<POD::Extended::InjectedSexa&>(mc_sexa) = fOutput.Injected[entry_inj.value()];
+    static_cast<POD::Extended::InjectedSexa&>(mc_sexa) = ev.Output.Injected[entry_inj.value()];
 
     return mc_sexa;
 }
 
 // ## Tracks ZONE ## //
 
-// Filter and group tracks into per-species vectors, together with their linked mc particles.
+// Filter tracks and store each selected one once, together with the species it passes as, then group their rows into
+// per-species views.
 // NOTE: a track can enter more than one species, as the pid hypotheses aren't exclusive.
-void Finder::ProcessTracks() {
-
-    // vectors preallocation //
-    const std::size_t n_total_tracks = fInput.Track.size();
-    fTemp_AntiProton.reserve(n_total_tracks);
-    fTemp_Proton.reserve(n_total_tracks);
-    fTemp_NegKaon.reserve(n_total_tracks);
-    fTemp_PosKaon.reserve(n_total_tracks);
-    fTemp_PiMinus.reserve(n_total_tracks);
-    fTemp_PiPlus.reserve(n_total_tracks);
-    if (fSettings.IsMC) {
-        fTemp_MC_AntiProton.reserve(n_total_tracks);
-        fTemp_MC_Proton.reserve(n_total_tracks);
-        fTemp_MC_NegKaon.reserve(n_total_tracks);
-        fTemp_MC_PosKaon.reserve(n_total_tracks);
-        fTemp_MC_PiMinus.reserve(n_total_tracks);
-        fTemp_MC_PiPlus.reserve(n_total_tracks);
-    }
+// NOTE: no preallocation, as the columns of the store keep their capacity from one event to the next, and the views
+//       live in the arena of the event.
+template <bool IsMC>
+void Finder<IsMC>::ProcessTracks(EventState& ev) {
+
+    Timers::Scoped timer(Timers::ETimer::ProcessTracks);
+
+    // -- helix parameters of each track are computed once here, then shared by every pair it takes part in
+    ev.Tracks.Reset(ev.Input.Track, ev.MagneticField);
 
     // loop over all pre-selected tracks //
+    const std::size_t n_total_tracks = ev.Input.Track.size();
     for (std::size_t entry_track = 0; entry_track < n_total_tracks; ++entry_track) {
-        const POD::Track& track = fInput.Track[entry_track];  // cache index lookup
+        const POD::Track& track = ev.Input.Track[entry_track];  // cache index lookup
+        const auto idx_track = static_cast<TrackIdx>(entry_track);
 
         // PENDING: cache calculations to speed up cuts! maybe not needed? //
 
         // PID and pre-selection //
+        std::uint8_t species = 0;
         if (track.Charge < 0) {
-            if (PassesCuts_Proton(track, fHist_CutFlow_AntiProton.get())) {
-                fTemp_AntiProton.emplace_back(track);
-                if (fSettings.IsMC) {
-                    fTemp_MC_AntiProton.emplace_back(
-                        BuildMcTrack(fInput.Track_McEntry[entry_track], DB::Particles::Particle("AntiProton").pdg_code, true));
-                }
-            }
-            if (PassesCuts_Kaon(track, fHist_CutFlow_NegKaon.get())) {
-                fTemp_NegKaon.emplace_back(track);
-                if (fSettings.IsMC) {
-                    fTemp_MC_NegKaon.emplace_back(BuildMcTrack(fInput.Track_McEntry[entry_track], DB::Particles::Particle("NegKaon").pdg_code, true));
-                }
-            }
-            if (PassesCuts_Pion(track, fHist_CutFlow_PiMinus.get())) {
-                fTemp_PiMinus.emplace_back(track);
-                if (fSettings.IsMC) {
-                    fTemp_MC_PiMinus.emplace_back(BuildMcTrack(fInput.Track_McEntry[entry_track], DB::Particles::Particle("PiMinus").pdg_code, true));
-                }
-            }
+            if (PassesCuts_Proton(track, &fCutFlow_AntiProton)) species |= kAntiProton;
+            if (PassesCuts_Kaon(track, &fCutFlow_NegKaon)) species |= kNegKaon;
+            if (PassesCuts_Pion(track, &fCutFlow_PiMinus)) species |= kPiMinus;
         }
         if (track.Charge > 0) {
-            if (PassesCuts_Proton(track, fHist_CutFlow_Proton.get())) {
-                fTemp_Proton.emplace_back(track);
-                if (fSettings.IsMC) {
-                    fTemp_MC_Proton.emplace_back(BuildMcTrack(fInput.Track_McEntry[entry_track], DB::Particles::Particle("Proton").pdg_code, true));
-                }
-            }
-            if (PassesCuts_Kaon(track, fHist_CutFlow_PosKaon.get())) {
-                fTemp_PosKaon.emplace_back(track);
-                if (fSettings.IsMC) {
-                    fTemp_MC_PosKaon.emplace_back(BuildMcTrack(fInput.Track_McEntry[entry_track], DB::Particles::Particle("PosKaon").pdg_code, true));
-                }
-            }
-            if (PassesCuts_Pion(track, fHist_CutFlow_PiPlus.get())) {
-                fTemp_PiPlus.emplace_back(track);
-                if (fSettings.IsMC) {
-                    fTemp_MC_PiPlus.emplace_back(BuildMcTrack(fInput.Track_McEntry[entry_track], DB::Particles::Particle("PiPlus").pdg_code, true));
-                }
-            }
+            if (PassesCuts_Proton(track, &fCutFlow_Proton)) species |= kProton;
+            if (PassesCuts_Kaon(track, &fCutFlow_PosKaon)) species |= kPosKaon;
+            if (PassesCuts_Pion(track, &fCutFlow_PiPlus)) species |= kPiPlus;
         }
+        if (species == 0) continue;
+
+        // store //
+        const auto row = static_cast<Seeder::TrackView::Row>(ev.Tracks.Size());
+        ev.Tracks.Add(idx_track, species);
+        if ((species & kAntiProton) != 0) ev.AntiProton.rows.push_back(row);
+        if ((species & kProton) != 0) ev.Proton.rows.push_back(row);
+        if ((species & kNegKaon) != 0) ev.NegKaon.rows.push_back(row);
+        if ((species & kPosKaon) != 0) ev.PosKaon.rows.push_back(row);
+        if ((species & kPiMinus) != 0) ev.PiMinus.rows.push_back(row);
+        if ((species & kPiPlus) != 0) ev.PiPlus.rows.push_back(row);
     }  // end of loop over tracks
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "n_antiprotons = {}", fTemp_AntiProton.size());
-    Logger::Debug(__FUNCTION__, "n_protons     = {}", fTemp_Proton.size());
-    Logger::Debug(__FUNCTION__, "n_negkaons    = {}", fTemp_NegKaon.size());
-    Logger::Debug(__FUNCTION__, "n_poskaons    = {}", fTemp_PosKaon.size());
-    Logger::Debug(__FUNCTION__, "n_piminus     = {}", fTemp_PiMinus.size());
-    Logger::Debug(__FUNCTION__, "n_piplus      = {}", fTemp_PiPlus.size());
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "n_tracks      = {}", ev.Tracks.Size());
+        Logger::Debug(__FUNCTION__, "n_antiprotons = {}", ev.AntiProton.Size());
+        Logger::Debug(__FUNCTION__, "n_protons     = {}", ev.Proton.Size());
+        Logger::Debug(__FUNCTION__, "n_negkaons    = {}", ev.NegKaon.Size());
+        Logger::Debug(__FUNCTION__, "n_poskaons    = {}", ev.PosKaon.Size());
+        Logger::Debug(__FUNCTION__, "n_piminus     = {}", ev.PiMinus.Size());
+        Logger::Debug(__FUNCTION__, "n_piplus      = {}", ev.PiPlus.Size());
+    }
 }
 
-bool Finder::PassesCuts_Proton(const POD::Track& track, TH1D* cut_flow_hist) const {
-    FillHist(cut_flow_hist, EProton::kAllPossibleProtons);
+template <bool IsMC>
+bool Finder<IsMC>::PassesCuts_Proton(const POD::Track& track, CutFlow_Proton* cut_flow) const {
+    FillHist(cut_flow, EProton::kAllPossibleProtons);
 
     if (std::abs(static_cast<double>(track.NSigmasProton)) > T2DS::Cuts::Proton::AbsMax_NSigmasProton) return false;
-    FillHist(cut_flow_hist, EProton::kPasses_NSigmasProtons);
+    FillHist(cut_flow, EProton::kPasses_NSigmasProtons);
 
     return true;
 }
 
-bool Finder::PassesCuts_Kaon(const POD::Track& track, TH1D* cut_flow_hist) const {
-    FillHist(cut_flow_hist, EKaon::kAllPossibleKaons);
+template <bool IsMC>
+bool Finder<IsMC>::PassesCuts_Kaon(const POD::Track& track, CutFlow_Kaon* cut_flow) const {
+    FillHist(cut_flow, EKaon::kAllPossibleKaons);
 
     if (std::abs(static_cast<double>(track.NSigmasKaon)) > T2DS::Cuts::Kaon::AbsMax_NSigmasKaon) return false;
-    FillHist(cut_flow_hist, EKaon::kPasses_NSigmasKaons);
+    FillHist(cut_flow, EKaon::kPasses_NSigmasKaons);
 
     return true;
 }
 
-bool Finder::PassesCuts_Pion(const POD::Track& track, TH1D* cut_flow_hist) const {
-    FillHist(cut_flow_hist, EPion::kAllPossiblePions);
+template <bool IsMC>
+bool Finder<IsMC>::PassesCuts_Pion(const POD::Track& track, CutFlow_Pion* cut_flow) const {
+    FillHist(cut_flow, EPion::kAllPossiblePions);
 
     if (std::abs(static_cast<double>(track.NSigmasPion)) > T2DS::Cuts::Pion::AbsMax_NSigmasPion) return false;
-    FillHist(cut_flow_hist, EPion::kPasses_NSigmasPions);
+    FillHist(cut_flow, EPion::kPasses_NSigmasPions);
 
     return true;
 }
 
-POD::Extended::McParticle Finder::BuildMcTrack(unsigned int track_mc_entry, int pdg_code_hypothesis, bool include_gm) {
+template <bool IsMC>
+POD::Extended::McParticle Finder<IsMC>::BuildMcTrack(const EventState& ev, unsigned int track_mc_entry, int pdg_code_hypothesis, bool include_gm)
+    requires IsMC
+{
     // copy linked mc info //
-    POD::Extended::McParticle new_mc(fInput.McParticle[track_mc_entry]);
-    auto c = MC::SexaquarkRules::ClassifyDownstream(new_mc, fInput.McParticle, fMcSignalChannel.value(), pdg_code_hypothesis, include_gm, false);
+    POD::Extended::McParticle new_mc(ev.Input.McParticle[track_mc_entry]);
+    auto c = MC::SexaquarkRules::ClassifyDownstream(new_mc, ev.Input.McParticle, fMcSignalChannel.value(), pdg_code_hypothesis, include_gm, false);
     MC::Apply(new_mc, c);
     return new_mc;
 }
 
+// MC truth of a track under a pid hypothesis. Classifying it is expensive, and most tracks never reach a stored candidate,
+// hence it's deferred until they do, then memoised for the rest of the event.
+template <bool IsMC>
+const POD::Extended::McParticle& Finder<IsMC>::McTrack(EventState& ev, TrackIdx idx_track, int pdg_code_hypothesis)
+    requires IsMC
+{
+    const unsigned int track_mc_entry = ev.Input.Track_McEntry[idx_track];
+    constexpr bool include_gm = true;
+    return ev.MC_Tracks.Get(track_mc_entry, pdg_code_hypothesis, include_gm,
+                            [&] { return BuildMcTrack(ev, track_mc_entry, pdg_code_hypothesis, include_gm); });
+}
+
 // ## V0s ZONE ## //
 
-void Finder::FindV0s(const DB::Particles::Definition& pid) {
+// Every species fills its own vectors and cut-flow histogram, so they run as independent tasks.
+// The pairs they have in common are seeded beforehand, and only read from them.
+template <bool IsMC>
+void Finder<IsMC>::FindV0s(EventState& ev) {
+    SeedSharedV0Pairs(ev);
+
+    TaskGroup tasks(fTaskPool.get());
+    tasks.Run([&] { FindV0s(ev, DB::Particles::Particle("AntiLambda")); });
+    tasks.Run([&] { FindV0s(ev, DB::Particles::Particle("Lambda")); });
+    tasks.Run([&] { FindV0s(ev, DB::Particles::Particle("KaonZeroShort")); });
+    tasks.Wait();
+}
+
+// Seeding and its derivatives depend on the two helices only, not on the mass hypothesis. Thus, the pairs that take
+// part in more than one hypothesis are solved once here, and only the fit is repeated per hypothesis.
+template <bool IsMC>
+void Finder<IsMC>::SeedSharedV0Pairs(EventState& ev) {
+    Timers::Scoped timer(Timers::ETimer::FindV0s_SharedPairs);
+
+    ev.SharedV0Pairs.Clear();
+    ev.PendingV0Pairs.clear();
+
+    // the derivatives are only needed by the pairs that pass the post-seed cuts of, at least, one hypothesis
+    const double max_dca = std::max(Cuts::Lambda::Max_DCAbtwDau, Cuts::KaonZeroShort::Max_DCAbtwDau);
+
+    // reserve a slot per shared pair //
+    // -- unless no hypothesis can accept it, see `PreSeedCuts_Lambda(...)`
+    const Seeder::TrackView& rows_neg = ev.PiMinus;
+    const Seeder::TrackView& rows_pos = ev.PiPlus;
+    for (std::size_t entry_neg = 0; entry_neg < rows_neg.Size(); ++entry_neg) {
+        const Seeder::TrackView::Row row_neg = rows_neg[entry_neg];
+        if ((ev.Tracks.selections[row_neg] & kAntiProton) == 0 && ev.Proton.Empty()) continue;
+        for (std::size_t entry_pos = 0; entry_pos < rows_pos.Size(); ++entry_pos) {
+            const Seeder::TrackView::Row row_pos = rows_pos[entry_pos];
+            if (!IsSharedV0Pair(ev, row_neg, row_pos)) continue;
+            if (!Seeder::HelixHelix::MeetWithin_XY(ev.Tracks, row_neg, ev.Tracks, row_pos, Seeder::HelixHelix::MaxGap_XY(max_dca))) continue;
+            const std::size_t slot = ev.SharedV0Pairs.Insert(ev.Tracks.entry[row_neg], ev.Tracks.entry[row_pos]);
+            ev.PendingV0Pairs.push_back({.row_neg = row_neg, .row_pos = row_pos, .slot = static_cast<std::uint32_t>(slot)});
+        }
+    }
+    if (ev.PendingV0Pairs.empty()) return;
+
+    // seed them, in chunks of pairs //
+    // -- every task writes into its own slots, while the cache's keys are left untouched
+    constexpr std::size_t kPairsPerTask = 256;  // HARDCODED
+    TaskGroup tasks(fTaskPool.get());
+    for (std::size_t first = 0; first < ev.PendingV0Pairs.size(); first += kPairsPerTask) {
+        const std::size_t last = std::min(first + kPairsPerTask, ev.PendingV0Pairs.size());
+        tasks.Run([&ev, max_dca, first, last] {
+            for (std::size_t i = first; i < last; ++i) {
+                const SharedV0Pair& pair = ev.PendingV0Pairs[i];
+                Seeder::PairSeeds& seeds = ev.SharedV0Pairs.At(pair.slot);
+
+                auto [seed_neg, seed_pos, pca_cache] = Seeder::HelixHelix::FastCorrectPCAs(ev.Tracks, pair.row_neg, ev.Tracks, pair.row_pos);
+                seeds.seed1 = seed_neg;
+                seeds.seed2 = seed_pos;
+
+                if (CMath::SquaredDistance(seed_neg.pca.xyz, seed_pos.pca.xyz) > max_dca * max_dca) continue;
+                std::tie(seeds.deriv1, seeds.deriv2) = Seeder::HelixHelix::ComputeDerivatives(seed_neg, seed_pos, pca_cache);
+                seeds.has_derivs = true;
+            }
+        });
+    }
+    tasks.Wait();
+
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "n_shared_v0_pairs = {}", ev.SharedV0Pairs.Size());
+    }
+}
+
+template <bool IsMC>
+void Finder<IsMC>::FindV0s(EventState& ev, const DB::Particles::Definition& pid) {
 
     // determine rules based on V0 species //
-    const std::vector<POD::Track>* temp_vec_neg = &fTemp_PiMinus;
-    const std::vector<POD::Track>* temp_vec_pos = &fTemp_PiPlus;
-    const std::vector<POD::Extended::McParticle>* temp_vec_mc_neg = &fTemp_MC_PiMinus;
-    const std::vector<POD::Extended::McParticle>* temp_vec_mc_pos = &fTemp_MC_PiPlus;
+    const Seeder::TrackView* temp_vec_neg = &ev.PiMinus;
+    const Seeder::TrackView* temp_vec_pos = &ev.PiPlus;
     auto pid_neg = DB::Particles::Particle("PiMinus");
     auto pid_pos = DB::Particles::Particle("PiPlus");
-    std::vector<POD::V0>* output_vec_v0 = nullptr;
-    std::vector<POD::Track>* output_vec_v0_neg = nullptr;
-    std::vector<POD::Track>* output_vec_v0_pos = nullptr;
-    std::vector<POD::Extended::McParticle>* output_vec_mc_v0 = nullptr;
-    std::vector<POD::Extended::McParticle>* output_vec_mc_v0_neg = nullptr;
-    std::vector<POD::Extended::McParticle>* output_vec_mc_v0_pos = nullptr;
+    std::pmr::vector<POD::V0>* output_vec_v0 = nullptr;
+    std::pmr::vector<TrackIdx>* output_vec_v0_neg = nullptr;
+    std::pmr::vector<TrackIdx>* output_vec_v0_pos = nullptr;
+    Mc<std::pmr::vector<POD::Extended::McParticle>>* output_vec_mc_v0 = nullptr;
+    Mc<std::pmr::vector<POD::Extended::McParticle>>* output_vec_mc_v0_neg = nullptr;
+    Mc<std::pmr::vector<POD::Extended::McParticle>>* output_vec_mc_v0_pos = nullptr;
+    Timers::ETimer timer_id{};
+    Metrics::ESelection selection{};
+    double max_dca{};
     switch (pid.pdg_code) {
         case DB::Particles::Particle("AntiLambda").pdg_code: {
-            temp_vec_neg = &fTemp_AntiProton;
-            temp_vec_mc_neg = &fTemp_MC_AntiProton;
+            temp_vec_neg = &ev.AntiProton;
             pid_neg = DB::Particles::Particle("AntiProton");
-            output_vec_v0 = &fTemp_AntiLambda;
-            output_vec_v0_neg = &fTemp_AntiLambda_Neg;
-            output_vec_v0_pos = &fTemp_AntiLambda_Pos;
-            output_vec_mc_v0 = &fTemp_MC_AntiLambda;
-            output_vec_mc_v0_neg = &fTemp_MC_AntiLambda_Neg;
-            output_vec_mc_v0_pos = &fTemp_MC_AntiLambda_Pos;
+            output_vec_v0 = &ev.AntiLambda;
+            output_vec_v0_neg = &ev.AntiLambda_Neg;
+            output_vec_v0_pos = &ev.AntiLambda_Pos;
+            output_vec_mc_v0 = &ev.MC_AntiLambda;
+            output_vec_mc_v0_neg = &ev.MC_AntiLambda_Neg;
+            output_vec_mc_v0_pos = &ev.MC_AntiLambda_Pos;
+            timer_id = Timers::ETimer::FindV0s_AntiLambda;
+            selection = Metrics::ESelection::AntiLambda;
+            max_dca = Cuts::Lambda::Max_DCAbtwDau;
             break;
         }
         case DB::Particles::Particle("Lambda").pdg_code: {
-            temp_vec_pos = &fTemp_Proton;
-            temp_vec_mc_pos = &fTemp_MC_Proton;
+            temp_vec_pos = &ev.Proton;
             pid_pos = DB::Particles::Particle("Proton");
-            output_vec_v0 = &fTemp_Lambda;
-            output_vec_v0_neg = &fTemp_Lambda_Neg;
-            output_vec_v0_pos = &fTemp_Lambda_Pos;
-            output_vec_mc_v0 = &fTemp_MC_Lambda;
-            output_vec_mc_v0_neg = &fTemp_MC_Lambda_Neg;
-            output_vec_mc_v0_pos = &fTemp_MC_Lambda_Pos;
+            output_vec_v0 = &ev.Lambda;
+            output_vec_v0_neg = &ev.Lambda_Neg;
+            output_vec_v0_pos = &ev.Lambda_Pos;
+            output_vec_mc_v0 = &ev.MC_Lambda;
+            output_vec_mc_v0_neg = &ev.MC_Lambda_Neg;
+            output_vec_mc_v0_pos = &ev.MC_Lambda_Pos;
+            timer_id = Timers::ETimer::FindV0s_Lambda;
+            selection = Metrics::ESelection::Lambda;
+            max_dca = Cuts::Lambda::Max_DCAbtwDau;
             break;
         }
         case DB::Particles::Particle("KaonZeroShort").pdg_code: {
-            output_vec_v0 = &fTemp_KaonZeroShort;
-            output_vec_v0_neg = &fTemp_KaonZeroShort_Neg;
-            output_vec_v0_pos = &fTemp_KaonZeroShort_Pos;
-            output_vec_mc_v0 = &fTemp_MC_KaonZeroShort;
-            output_vec_mc_v0_neg = &fTemp_MC_KaonZeroShort_Neg;
-            output_vec_mc_v0_pos = &fTemp_MC_KaonZeroShort_Pos;
+            output_vec_v0 = &ev.KaonZeroShort;
+            output_vec_v0_neg = &ev.KaonZeroShort_Neg;
+            output_vec_v0_pos = &ev.KaonZeroShort_Pos;
+            output_vec_mc_v0 = &ev.MC_KaonZeroShort;
+            output_vec_mc_v0_neg = &ev.MC_KaonZeroShort_Neg;
+            output_vec_mc_v0_pos = &ev.MC_KaonZeroShort_Pos;
+            timer_id = Timers::ETimer::FindV0s_KaonZeroShort;
+            selection = Metrics::ESelection::KaonZeroShort;
+            max_dca = Cuts::KaonZeroShort::Max_DCAbtwDau;
             break;
         }
         default: {
@@ -414,148 +526,360 @@ void Finder::FindV0s(const DB::Particles::Definition& pid) {
         }
     }
 
+    Timers::Scoped timer(timer_id);
+
     // determine fit policy
     const KF::FitPolicy fit_policy = GetPolicy_V0s(pid.mass);
 
     // loop over all possible pairs of tracks //
     // NOTE: negative and positive species never share a track, hence no sanity check is needed
-    for (std::size_t entry_neg = 0; entry_neg < temp_vec_neg->size(); ++entry_neg) {
-        const POD::Track& track_neg = (*temp_vec_neg)[entry_neg];  // cache index lookup
+    const Seeder::TrackStore& tracks = ev.Tracks;
+    const Seeder::TrackView& rows_neg = *temp_vec_neg;
+    const Seeder::TrackView& rows_pos = *temp_vec_pos;
+
+    // with `--pair-grid`, pair each negative track only with the positive tracks that can come close enough //
+    // -- the rest would be rejected by the pre-seed cuts, and are only counted as such, thus the output doesn't change
+    Seeder::PairGrid grid(&ev.Memory);
+    std::pmr::vector<Seeder::PairGrid::Index> partners(&ev.Memory);
+    if (fSettings.PairGrid) grid.Build(tracks, rows_pos, Seeder::HelixHelix::MaxGap_XY(max_dca));
+
+    // pairs of the current negative track that pass the pre-seed cuts, in order, and the block of those to be seeded //
+    struct Partner {
+        Seeder::TrackView::Row row_pos;
+        const Seeder::PairSeeds* shared;
+    };
+    std::pmr::vector<Partner> candidates(&ev.Memory);
+    std::pmr::vector<Seeder::TrackView::Row> block_neg(&ev.Memory);
+    std::pmr::vector<Seeder::TrackView::Row> block_pos(&ev.Memory);
+    std::pmr::vector<double> block_dca2(&ev.Memory);
+    std::pmr::vector<float> block_dca2_float(&ev.Memory);
+    std::pmr::vector<std::uint32_t> survivors(&ev.Memory);
+    std::pmr::vector<std::uint32_t> survivors_float(&ev.Memory);
+    const bool in_float = fSettings.SeedingPrecision == ESeedingPrecision::Float;
+
+    for (std::size_t entry_neg = 0; entry_neg < rows_neg.Size(); ++entry_neg) {
+        const Seeder::TrackView::Row row_neg = rows_neg[entry_neg];
+        const TrackIdx idx_neg = tracks.entry[row_neg];
+
+        if (fSettings.PairGrid) {
+            grid.Query(tracks, row_neg, partners);
+            if (fSettings.CrossCheck) CrossCheckPartners(tracks, row_neg, rows_pos, partners, max_dca, pid);
+            CountRejectedInBulk(pid, selection, rows_pos.Size() - partners.size());
+        }
+        const std::size_t n_partners = fSettings.PairGrid ? partners.size() : rows_pos.Size();
 
-        for (std::size_t entry_pos = 0; entry_pos < temp_vec_pos->size(); ++entry_pos) {
-            const POD::Track& track_pos = (*temp_vec_pos)[entry_pos];  // cache index lookup
+        // apply cuts (1) //
+        candidates.clear();
+        block_neg.clear();
+        block_pos.clear();
+        for (std::size_t i_partner = 0; i_partner < n_partners; ++i_partner) {
+            const std::size_t entry_pos = fSettings.PairGrid ? partners[i_partner] : i_partner;
+            const Seeder::TrackView::Row row_pos = rows_pos[entry_pos];
 
-            // apply cuts (1) //
             // PENDING: placeholder to remove duplications
+            // -- a pair rejected here would fail the post-seed cuts as well, hence it's counted as such
+            if (!PreSeedCuts(tracks, row_neg, row_pos, pid)) {
+                Metrics::CountCut(selection, Metrics::EStep::PostSeedCuts, false);
+                continue;
+            }
 
-            // PCAs //
-            auto [seed_neg, seed_pos, pca_cache] = Seeder::HelixHelix::FastCorrectPCAs(track_neg, track_pos, fMagneticField);
+            // -- pairs shared with other hypotheses were already seeded, in `SeedSharedV0Pairs(...)`
+            const Seeder::PairSeeds* shared = IsSharedV0Pair(ev, row_neg, row_pos) ? ev.SharedV0Pairs.Find(idx_neg, tracks.entry[row_pos]) : nullptr;
+            candidates.push_back({.row_pos = row_pos, .shared = shared});
+            if (shared == nullptr) {
+                block_neg.push_back(row_neg);
+                block_pos.push_back(row_pos);
+            }
+        }
+
+        // PCAs (1) //
+        // -- the DCA of the seeds of the whole block at once, so that only the pairs that may pass the post-seed cuts
+        //    are seeded one by one, with their cache
+        const std::size_t n_block = block_pos.size();
+        std::size_t n_survivors = 0;
+        {
+            Timers::Scoped batch_timer(Timers::ETimer::SeedV0s_Batch);
+            if (in_float) {
+                // -- with `--seeding-precision float`, first in float, and then again in double, only for the pairs within
+                //    its margin of the cut, which are moved to the front of the block
+                block_dca2_float.resize(n_block);
+                survivors_float.resize(n_block);
+                Seeder::HelixHelix::SeedDCA2(tracks, block_neg, tracks, block_pos, block_dca2_float);
+                survivors_float.resize(Seeder::HelixHelix::CompactSurvivors(block_dca2_float, max_dca, survivors_float));
+                if (fSettings.CrossCheck) {
+                    CrossCheckSurvivors(tracks, block_neg, block_pos, survivors_float, max_dca, CrossCheck::ECheck::FloatSeeding, pid);
+                }
+                CountRejectedInBulk(pid, selection, n_block - survivors_float.size());
+                for (std::size_t i = 0; i < survivors_float.size(); ++i) {
+                    block_neg[i] = block_neg[survivors_float[i]];
+                    block_pos[i] = block_pos[survivors_float[i]];
+                }
+                block_neg.resize(survivors_float.size());
+                block_pos.resize(survivors_float.size());
+            }
+            block_dca2.resize(block_pos.size());
+            survivors.resize(block_pos.size());
+            Seeder::HelixHelix::SeedDCA2(tracks, block_neg, tracks, block_pos, block_dca2);
+            n_survivors = Seeder::HelixHelix::CompactSurvivors(block_dca2, max_dca, survivors);
+            survivors.resize(n_survivors);
+            if (fSettings.CrossCheck) {
+                CrossCheckSurvivors(tracks, block_neg, block_pos, survivors, max_dca, CrossCheck::ECheck::BatchSeeding, pid);
+                CrossCheckSeedingAccuracy(tracks, block_neg, block_pos, block_dca2, max_dca, pid);
+            }
+            CountRejectedInBulk(pid, selection, block_pos.size() - n_survivors);
+            // -- back to positions within the whole block
+            if (in_float) {
+                for (std::uint32_t& survivor : survivors) survivor = survivors_float[survivor];
+            }
+        }
+
+        std::size_t i_block = 0;
+        std::size_t i_survivor = 0;
+        for (const Partner& candidate : candidates) {
+            const Seeder::TrackView::Row row_pos = candidate.row_pos;
+            const TrackIdx idx_pos = tracks.entry[row_pos];
+            const Seeder::PairSeeds* shared = candidate.shared;
+
+            if (shared == nullptr) {
+                const bool survived = i_survivor < n_survivors && survivors[i_survivor] == i_block;
+                ++i_block;
+                if (!survived) continue;
+                ++i_survivor;
+            }
+
+            // PCAs (2) //
+            Seeder::PairSeeds own;
+            Seeder::HelixHelix::Cache pca_cache;
+            if (shared == nullptr) {
+                std::tie(own.seed1, own.seed2, pca_cache) = Seeder::HelixHelix::FastCorrectPCAs(tracks, row_neg, tracks, row_pos);
+            }
+            const Seeder::PairSeeds& seeds = shared != nullptr ? *shared : own;
 
             // apply cuts (2) //
-            if (!PostSeedCuts(seed_neg.pca, seed_pos.pca, pid)) continue;
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostSeedCuts, PostSeedCuts(seeds.seed1.pca, seeds.seed2.pca, pid))) continue;
 
             // PCAs derivatives //
-            auto [deriv_neg, deriv_pos] = Seeder::HelixHelix::ComputeDerivatives(seed_neg, seed_pos, pca_cache);
+            if (shared == nullptr) std::tie(own.deriv1, own.deriv2) = Seeder::HelixHelix::ComputeDerivatives(own.seed1, own.seed2, pca_cache);
 
             // fit vertex //
-            auto fit =
-                KF::FitVertex(track_neg, track_pos, pid_neg, pid_pos, {seed_neg, deriv_neg}, {seed_pos, deriv_pos}, fMagneticField, fit_policy);
+            auto fit = KF::FitVertex(tracks, row_neg, tracks, row_pos, pid_neg, pid_pos, {seeds.seed1, seeds.deriv1}, {seeds.seed2, seeds.deriv2},
+                                     ev.MagneticField, fit_policy);
 
             // create storage+computation units //
-            POD::V0 v0 = Create_V0(fit, seed_neg.pca, seed_pos.pca);
-            Cached::V0 c_v0(v0, fPrimaryVertex);
+            POD::V0 v0 = Create_V0(fit, seeds.seed1.pca, seeds.seed2.pca);
+            Cached::V0 c_v0(v0, ev.PrimaryVertex);
 
             // apply cuts (3) //
-            if (!PostFitCuts(c_v0, pid)) continue;
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostFitCuts, PostFitCuts(c_v0, pid))) continue;
 
             // store reconstructed //
             output_vec_v0->emplace_back(v0);
-            output_vec_v0_neg->emplace_back(track_neg);
-            output_vec_v0_pos->emplace_back(track_pos);
+            output_vec_v0_neg->push_back(idx_neg);
+            output_vec_v0_pos->push_back(idx_pos);
 
             // store mc //
-            // NOTE: the daughters were already built in `ProcessTracks(...)`, under this very same pid hypothesis
-            if (fSettings.IsMC) {
+            if constexpr (IsMC) {
                 // -- neg
-                const POD::Extended::McParticle& mc_neg = (*temp_vec_mc_neg)[entry_neg];
+                const POD::Extended::McParticle& mc_neg = McTrack(ev, idx_neg, pid_neg.pdg_code);
                 output_vec_mc_v0_neg->emplace_back(mc_neg);
                 // -- pos
-                const POD::Extended::McParticle& mc_pos = (*temp_vec_mc_pos)[entry_pos];
+                const POD::Extended::McParticle& mc_pos = McTrack(ev, idx_pos, pid_pos.pdg_code);
                 output_vec_mc_v0_pos->emplace_back(mc_pos);
                 // -- v0
-                output_vec_mc_v0->emplace_back(BuildMcV0(mc_neg, mc_pos, pid.pdg_code));
+                output_vec_mc_v0->emplace_back(BuildMcV0(ev, mc_neg, mc_pos, pid.pdg_code));
             }
         }  // end of loop over pos
     }  // end of loop over neg
 }
 
-bool Finder::PostSeedCuts_Lambda(const Seeder::PCA& pca_neg, const Seeder::PCA& pca_pos, TH1D* cut_flow_hist) const {
-    FillHist(cut_flow_hist, ELambda::kAllCombinations);
+// Compare the partners of a negative track found through the grid with those found by brute force: every positive track
+// that passes the pre-seed cuts must be among them.
+template <bool IsMC>
+void Finder<IsMC>::CrossCheckPartners(const Seeder::TrackStore& tracks, Seeder::TrackView::Row row_neg, const Seeder::TrackView& rows_pos,
+                                      std::span<const Seeder::PairGrid::Index> partners, double max_dca, const DB::Particles::Definition& pid) const {
+    std::size_t n_missed = 0;
+    for (std::size_t entry_pos = 0; entry_pos < rows_pos.Size(); ++entry_pos) {
+        if (!Seeder::HelixHelix::MeetWithin_XY(tracks, row_neg, tracks, rows_pos[entry_pos], Seeder::HelixHelix::MaxGap_XY(max_dca))) continue;
+        if (!std::binary_search(partners.begin(), partners.end(), static_cast<Seeder::PairGrid::Index>(entry_pos))) ++n_missed;
+    }
+    if (!CrossCheck::Record(CrossCheck::ECheck::PairGrid, n_missed == 0)) {
+        Logger::Error(__FUNCTION__, "{}: the grid missed {} partner(s) of track {}", pid.name, n_missed, tracks.entry[row_neg]);
+    }
+}
+
+// Compare the pairs rejected by a batched phase of seeding with the one-pair path: none of them may pass the post-seed
+// cuts.
+template <bool IsMC>
+void Finder<IsMC>::CrossCheckSurvivors(const Seeder::TrackStore& tracks, std::span<const Seeder::TrackView::Row> block_neg,
+                                       std::span<const Seeder::TrackView::Row> block_pos, std::span<const std::uint32_t> survivors,
+                                       double max_dca, CrossCheck::ECheck check, const DB::Particles::Definition& pid) const {
+    std::size_t n_lost = 0;
+    std::size_t i_survivor = 0;
+    for (std::size_t i_block = 0; i_block < block_pos.size(); ++i_block) {
+        if (i_survivor < survivors.size() && survivors[i_survivor] == i_block) {
+            ++i_survivor;
+            continue;
+        }
+        auto [seed_neg, seed_pos, pca_cache] = Seeder::HelixHelix::FastCorrectPCAs(tracks, block_neg[i_block], tracks, block_pos[i_block]);
+        if (!(CMath::SquaredDistance(seed_neg.pca.xyz, seed_pos.pca.xyz) > max_dca * max_dca)) ++n_lost;
+    }
+    if (!CrossCheck::Record(check, n_lost == 0)) {
+        Logger::Error(__FUNCTION__, "{}: {} lost {} pair(s) of track {}", pid.name, CrossCheck::Name_Check[static_cast<std::size_t>(check)],
+                      n_lost, block_neg.empty() ? 0 : tracks.entry[block_neg.front()]);
+    }
+}
+
+// Compare the seeds found by the batched first phase of seeding, in double, with the one-pair path: for the pairs near
+// the cut, the DCA must agree within the margin it keeps over it, and both PCAs within a fixed distance -- a phase error
+// in the vectorised `atan2` or `sincos` moves them along the helices, even where it leaves the DCA alone.
+template <bool IsMC>
+void Finder<IsMC>::CrossCheckSeedingAccuracy(const Seeder::TrackStore& tracks, std::span<const Seeder::TrackView::Row> block_neg,
+                                             std::span<const Seeder::TrackView::Row> block_pos, std::span<const double> block_dca2,
+                                             double max_dca, const DB::Particles::Definition& pid) const {
+    std::vector<std::array<double, 3>> block_pca_neg(block_pos.size());
+    std::vector<std::array<double, 3>> block_pca_pos(block_pos.size());
+    Seeder::HelixHelix::SeedPCAs(tracks, block_neg, tracks, block_pos, block_pca_neg, block_pca_pos);
+
+    std::size_t n_off = 0;
+    double max_diff_dca = 0.;
+    double max_diff_pca = 0.;
+    for (std::size_t i_block = 0; i_block < block_pos.size(); ++i_block) {
+        auto [seed_neg, seed_pos, pca_cache] = Seeder::HelixHelix::FastCorrectPCAs(tracks, block_neg[i_block], tracks, block_pos[i_block]);
+        const double dca = std::sqrt(CMath::SquaredDistance(seed_neg.pca.xyz, seed_pos.pca.xyz));
+        // -- near the cut, i.e. where a difference could move a pair across it, and not left to the one-pair path
+        if (!(dca <= 2. * max_dca) || std::isnan(block_dca2[i_block])) continue;
+        const double diff_dca = std::abs(std::sqrt(block_dca2[i_block]) - dca);
+        const double diff_pca = std::sqrt(std::max(CMath::SquaredDistance(block_pca_neg[i_block], seed_neg.pca.xyz),
+                                                   CMath::SquaredDistance(block_pca_pos[i_block], seed_pos.pca.xyz)));
+        if (!(diff_dca <= Seeder::HelixHelix::kBatchMargin * max_dca) || !(diff_pca <= Seeder::HelixHelix::kBatchTolerance_PCA)) ++n_off;
+        max_diff_dca = std::max(max_diff_dca, diff_dca);
+        max_diff_pca = std::max(max_diff_pca, diff_pca);
+    }
+    if (!CrossCheck::Record(CrossCheck::ECheck::SeedingAccuracy, n_off == 0)) {
+        Logger::Error(__FUNCTION__, "{}: the batched seeding is off in {} pair(s) of track {}, by up to {:.3e} cm in the DCA, {:.3e} cm in the PCAs",
+                      pid.name, n_off, block_neg.empty() ? 0 : tracks.entry[block_neg.front()], max_diff_dca, max_diff_pca);
+    }
+}
+
+// The DCA between the daughters can't be shorter than the gap between their circles, so pairs whose circles are too
+// far apart are rejected before seeding them -- as are those whose circles only come close outside the fiducial decay
+// region. They count as combinations that didn't pass the DCA cut.
+template <bool IsMC>
+bool Finder<IsMC>::PreSeedCuts_Lambda(const Seeder::TrackStore& tracks, Seeder::TrackView::Row row_neg, Seeder::TrackView::Row row_pos,
+                                      CutFlow_Lambda* cut_flow) const {
+    const double max_gap = Seeder::HelixHelix::MaxGap_XY(Cuts::Lambda::Max_DCAbtwDau);
+    if (!Seeder::HelixHelix::MeetWithin_XY(tracks, row_neg, tracks, row_pos, max_gap)) {
+        FillHist(cut_flow, ELambda::kAllCombinations);
+        return false;
+    }
+    return true;
+}
+
+template <bool IsMC>
+bool Finder<IsMC>::PreSeedCuts_KaonZeroShort(const Seeder::TrackStore& tracks, Seeder::TrackView::Row row_neg, Seeder::TrackView::Row row_pos,
+                                             CutFlow_KaonZeroShort* cut_flow) const {
+    const double max_gap = Seeder::HelixHelix::MaxGap_XY(T2DS::Cuts::KaonZeroShort::Max_DCAbtwDau);
+    if (!Seeder::HelixHelix::MeetWithin_XY(tracks, row_neg, tracks, row_pos, max_gap)) {
+        FillHist(cut_flow, EKaonZeroShort::kAllCombinations);
+        return false;
+    }
+    return true;
+}
+
+template <bool IsMC>
+bool Finder<IsMC>::PostSeedCuts_Lambda(const Seeder::PCA& pca_neg, const Seeder::PCA& pca_pos, CutFlow_Lambda* cut_flow) const {
+    FillHist(cut_flow, ELambda::kAllCombinations);
 
     if (CMath::SquaredDistance(pca_neg.xyz, pca_pos.xyz) > Cuts::Lambda::Max_DCAbtwDau * Cuts::Lambda::Max_DCAbtwDau) {
         return false;
     }
-    FillHist(cut_flow_hist, ELambda::kPasses_DcaBtwDaughters);
+    FillHist(cut_flow, ELambda::kPasses_DcaBtwDaughters);
 
     return true;
 }
 
-bool Finder::PostSeedCuts_KaonZeroShort(const Seeder::PCA& pca_neg, const Seeder::PCA& pca_pos, TH1D* cut_flow_hist) const {
-    FillHist(cut_flow_hist, EKaonZeroShort::kAllCombinations);
+template <bool IsMC>
+bool Finder<IsMC>::PostSeedCuts_KaonZeroShort(const Seeder::PCA& pca_neg, const Seeder::PCA& pca_pos, CutFlow_KaonZeroShort* cut_flow) const {
+    FillHist(cut_flow, EKaonZeroShort::kAllCombinations);
 
     if (CMath::SquaredDistance(pca_neg.xyz, pca_pos.xyz) > T2DS::Cuts::KaonZeroShort::Max_DCAbtwDau * T2DS::Cuts::KaonZeroShort::Max_DCAbtwDau) {
         return false;
     }
-    FillHist(cut_flow_hist, EKaonZeroShort::kPasses_DcaBtwDaughters);
+    FillHist(cut_flow, EKaonZeroShort::kPasses_DcaBtwDaughters);
 
     return true;
 }
 
-bool Finder::PostFitCuts_Lambda(const Cached::V0& c_v0, TH1D* cut_flow_hist) const {
+template <bool IsMC>
+bool Finder<IsMC>::PostFitCuts_Lambda(const Cached::V0& c_v0, CutFlow_Lambda* cut_flow) const {
 
     // double mass = c_v0.Mass();  // cached // PENDING
     // if (mass < Cuts::Lambda::Min_Mass || mass > Cuts::Lambda::Max_Mass) return false; // PENDING
-    // FillHist(cut_flow_hist, 2.);  // PENDING
+    // FillHist(cut_flow, 2.);  // PENDING
 
     if (c_v0.Decay_SquaredRadius2D() < Cuts::Lambda::Min_Decay_Radius2D * Cuts::Lambda::Min_Decay_Radius2D) return false;
-    // FillHist(cut_flow_hist, 3.);  // PENDING
+    // FillHist(cut_flow, 3.);  // PENDING
 
     if (c_v0.Neg_SquaredDCA_wrt_V0() > Cuts::Lambda::Max_DCAnegV0 * Cuts::Lambda::Max_DCAnegV0) return false;
-    // FillHist(cut_flow_hist, 4.);  // PENDING
+    // FillHist(cut_flow, 4.);  // PENDING
 
     if (c_v0.Pos_SquaredDCA_wrt_V0() > Cuts::Lambda::Max_DCAposV0 * Cuts::Lambda::Max_DCAposV0) return false;
-    // FillHist(cut_flow_hist, 5.);  // PENDING
+    // FillHist(cut_flow, 5.);  // PENDING
 
     // if (c_v0.Pt() < Cuts::Lambda::Min_Pt) return false; // PENDING
-    // FillHist(cut_flow_hist, 6.);  // PENDING
+    // FillHist(cut_flow, 6.);  // PENDING
 
     if (std::abs(c_v0.Rapidity()) > Cuts::Lambda::AbsMax_Rapidity) return false;
-    // FillHist(cut_flow_hist, 7.);  // PENDING
+    // FillHist(cut_flow, 7.);  // PENDING
 
     // if (c_v0.AbsArmQtOverAlpha() > Cuts::Lambda::AbsMax_ArmQtOverAlpha) return false;  // PENDING: not really sure if i like this cut, actually
-    // FillHist(cut_flow_hist, 8.);  // PENDING
+    // FillHist(cut_flow, 8.);  // PENDING
 
     if (c_v0.CPA_wrt_PV() < Cuts::Lambda::Min_CPAwrtPV || c_v0.CPA_wrt_PV() > Cuts::Lambda::Max_CPAwrtPV) return false;
-    // FillHist(cut_flow_hist, 8.);  // PENDING
+    // FillHist(cut_flow, 8.);  // PENDING
 
     if (c_v0.SquaredDCA_wrt_PV() < Cuts::Lambda::Min_DCAwrtPV * Cuts::Lambda::Min_DCAwrtPV) return false;
-    // FillHist(cut_flow_hist, 9.);  // PENDING
+    // FillHist(cut_flow, 9.);  // PENDING
 
     return true;
 }
 
-bool Finder::PostFitCuts_KaonZeroShort(const Cached::V0& c_v0, TH1D* cut_flow_hist) const {
+template <bool IsMC>
+bool Finder<IsMC>::PostFitCuts_KaonZeroShort(const Cached::V0& c_v0, CutFlow_KaonZeroShort* cut_flow) const {
 
     // if (c_v0.Pt() < Cuts::KaonZeroShort::Min_Pt) return false; // PENDING
-    // FillHist(cut_flow_hist, 2.);  // PENDING
+    // FillHist(cut_flow, 2.);  // PENDING
 
     // double mass = c_v0.Mass();  // cached // PENDING
     // if (mass < Cuts::KaonZeroShort::Min_Mass || mass > Cuts::KaonZeroShort::Max_Mass) return false; // PENDING
-    // FillHist(cut_flow_hist, 3.); // PENDING
+    // FillHist(cut_flow, 3.); // PENDING
 
     if (std::abs(c_v0.Rapidity()) > Cuts::KaonZeroShort::AbsMax_Rapidity) return false;
-    // FillHist(cut_flow_hist, 4.); // PENDING
+    // FillHist(cut_flow, 4.); // PENDING
 
     if (c_v0.Decay_SquaredRadius2D() < Cuts::KaonZeroShort::Min_Decay_Radius2D * Cuts::KaonZeroShort::Min_Decay_Radius2D) return false;
-    // FillHist(cut_flow_hist, 5.); // PENDING
+    // FillHist(cut_flow, 5.); // PENDING
 
     if (c_v0.Neg_SquaredDCA_wrt_V0() > Cuts::KaonZeroShort::Max_DCAnegV0 * Cuts::KaonZeroShort::Max_DCAnegV0) return false;
-    // FillHist(cut_flow_hist, 6.); // PENDING
+    // FillHist(cut_flow, 6.); // PENDING
 
     if (c_v0.Pos_SquaredDCA_wrt_V0() > Cuts::KaonZeroShort::Max_DCAposV0 * Cuts::KaonZeroShort::Max_DCAposV0) return false;
-    // FillHist(cut_flow_hist, 7.); // PENDING
+    // FillHist(cut_flow, 7.); // PENDING
 
     if (c_v0.CPA_wrt_PV() < Cuts::KaonZeroShort::Min_CPAwrtPV || c_v0.CPA_wrt_PV() > Cuts::KaonZeroShort::Max_CPAwrtPV) return false;
-    // FillHist(cut_flow_hist, 8.); // PENDING
+    // FillHist(cut_flow, 8.); // PENDING
 
     if (c_v0.SquaredDCA_wrt_PV() < Cuts::KaonZeroShort::Min_DCAwrtPV * Cuts::KaonZeroShort::Min_DCAwrtPV) return false;
-    // FillHist(cut_flow_hist, 9.); // PENDING
+    // FillHist(cut_flow, 9.); // PENDING
 
     return true;
 }
 
-POD::Extended::McParticle Finder::BuildMcV0(const POD::Extended::McParticle& mc_neg, const POD::Extended::McParticle& mc_pos,
-                                            int pdg_code_hypothesis) {
+template <bool IsMC>
+POD::Extended::McParticle Finder<IsMC>::BuildMcV0(const EventState& ev, const POD::Extended::McParticle& mc_neg,
+                                                  const POD::Extended::McParticle& mc_pos, int pdg_code_hypothesis)
+    requires IsMC
+{
     POD::Extended::McParticle mc_v0;
 
     // -- fill hybridness, independetly of no common mother
@@ -565,13 +889,14 @@ POD::Extended::McParticle Finder::BuildMcV0(const POD::Extended::McParticle& mc_
     if (!mc_entry.has_value()) return mc_v0;
 
     // fill values //
-    static_cast<POD::McParticle&>(mc_v0) = fInput.McParticle[mc_entry.value()];
-    MC::Apply(mc_v0, MC::SexaquarkRules::ClassifyDownstream(mc_v0, fInput.McParticle, fMcSignalChannel.value(), pdg_code_hypothesis, false, true));
+    static_cast<POD::McParticle&>(mc_v0) = ev.Input.McParticle[mc_entry.value()];
+    MC::Apply(mc_v0, MC::SexaquarkRules::ClassifyDownstream(mc_v0, ev.Input.McParticle, fMcSignalChannel.value(), pdg_code_hypothesis, false, true));
 
     return mc_v0;
 }
 
-POD::V0 Finder::Create_V0(const KF::FitResult& fit, const Seeder::PCA& neg_pca_wrt_v0, const Seeder::PCA& pos_pca_wrt_v0) {
+template <bool IsMC>
+POD::V0 Finder<IsMC>::Create_V0(const KF::FitResult& fit, const Seeder::PCA& neg_pca_wrt_v0, const Seeder::PCA& pos_pca_wrt_v0) {
     POD::V0 new_v0;  // non-initialized on purpose
     // candidate info
     new_v0.Decay_X = static_cast<float>(fit.mother.X());
@@ -603,47 +928,124 @@ POD::V0 Finder::Create_V0(const KF::FitResult& fit, const Seeder::PCA& neg_pca_w
     return new_v0;
 }
 
+// ## SEXAQUARKS ZONE ## //
+
+// The six passes only read the V0s and kaons, and each fills its own cut-flow histogram, so they run as independent
+// tasks. Each channel owns its columns of the output, but signal and background passes of the same channel share them:
+// background passes write into `Output_Bkg`, which is appended afterwards -- same order as running them one by one.
+template <bool IsMC>
+void Finder<IsMC>::FindSexaquarks(EventState& ev) {
+    {
+        TaskGroup tasks(fTaskPool.get());
+        tasks.Run([&] { FindSexaquarks_ChannelA(ev, false); });
+        tasks.Run([&] { FindSexaquarks_ChannelA(ev, true); });
+        tasks.Run([&] { FindSexaquarks_ChannelD(ev, false); });
+        tasks.Run([&] { FindSexaquarks_ChannelD(ev, true); });
+        tasks.Run([&] { FindSexaquarks_ChannelH(ev, false); });
+        tasks.Run([&] { FindSexaquarks_ChannelH(ev, true); });
+        tasks.Wait();
+    }
+    AppendBkgCandidates(ev);
+}
+
+namespace {
+template <typename T>
+void Append(std::vector<T>& into, std::vector<T>& from) {
+    into.insert(into.end(), std::make_move_iterator(from.begin()), std::make_move_iterator(from.end()));
+    from.clear();
+}
+}  // namespace
+
+template <bool IsMC>
+void Finder<IsMC>::AppendBkgCandidates(EventState& ev) const {
+    auto& out = ev.Output;
+    auto& bkg = ev.Output_Bkg;
+
+    // rec //
+    Append(out.ChannelA, bkg.ChannelA);
+    Append(out.ChannelA_V0A, bkg.ChannelA_V0A);
+    Append(out.ChannelA_V0A_Neg, bkg.ChannelA_V0A_Neg);
+    Append(out.ChannelA_V0A_Pos, bkg.ChannelA_V0A_Pos);
+    Append(out.ChannelA_V0B, bkg.ChannelA_V0B);
+    Append(out.ChannelA_V0B_Neg, bkg.ChannelA_V0B_Neg);
+    Append(out.ChannelA_V0B_Pos, bkg.ChannelA_V0B_Pos);
+    Append(out.ChannelD, bkg.ChannelD);
+    Append(out.ChannelD_V0, bkg.ChannelD_V0);
+    Append(out.ChannelD_V0_Neg, bkg.ChannelD_V0_Neg);
+    Append(out.ChannelD_V0_Pos, bkg.ChannelD_V0_Pos);
+    Append(out.ChannelD_Kaon, bkg.ChannelD_Kaon);
+    Append(out.ChannelH, bkg.ChannelH);
+    Append(out.ChannelH_Kaon1, bkg.ChannelH_Kaon1);
+    Append(out.ChannelH_Kaon2, bkg.ChannelH_Kaon2);
+
+    if constexpr (!IsMC) return;
+
+    // mc //
+    Append(out.MC_ChannelA, bkg.MC_ChannelA);
+    Append(out.MC_ChannelA_V0A, bkg.MC_ChannelA_V0A);
+    Append(out.MC_ChannelA_V0A_Neg, bkg.MC_ChannelA_V0A_Neg);
+    Append(out.MC_ChannelA_V0A_Pos, bkg.MC_ChannelA_V0A_Pos);
+    Append(out.MC_ChannelA_V0B, bkg.MC_ChannelA_V0B);
+    Append(out.MC_ChannelA_V0B_Neg, bkg.MC_ChannelA_V0B_Neg);
+    Append(out.MC_ChannelA_V0B_Pos, bkg.MC_ChannelA_V0B_Pos);
+    Append(out.MC_ChannelD, bkg.MC_ChannelD);
+    Append(out.MC_ChannelD_V0, bkg.MC_ChannelD_V0);
+    Append(out.MC_ChannelD_V0_Neg, bkg.MC_ChannelD_V0_Neg);
+    Append(out.MC_ChannelD_V0_Pos, bkg.MC_ChannelD_V0_Pos);
+    Append(out.MC_ChannelD_Kaon, bkg.MC_ChannelD_Kaon);
+    Append(out.MC_ChannelH, bkg.MC_ChannelH);
+    Append(out.MC_ChannelH_Kaon1, bkg.MC_ChannelH_Kaon1);
+    Append(out.MC_ChannelH_Kaon2, bkg.MC_ChannelH_Kaon2);
+}
+
 // ## Channel A ZONE ## //
 
-void Finder::FindSexaquarks_ChannelA(bool is_bkg_channel) {
+template <bool IsMC>
+void Finder<IsMC>::FindSexaquarks_ChannelA(EventState& ev, bool is_bkg_channel) {
+
+    Timers::Scoped timer(is_bkg_channel ? Timers::ETimer::ChannelA_Bkg : Timers::ETimer::ChannelA);
+    const auto selection = is_bkg_channel ? Metrics::ESelection::ChannelA_Bkg : Metrics::ESelection::ChannelA;
 
     // determine rules and aliases //
     // (anti)lambdas
     // -- rec
-    const auto& input_lambdas = is_bkg_channel ? fTemp_Lambda : fTemp_AntiLambda;
-    const auto& input_lambdas_neg = is_bkg_channel ? fTemp_Lambda_Neg : fTemp_AntiLambda_Neg;
-    const auto& input_lambdas_pos = is_bkg_channel ? fTemp_Lambda_Pos : fTemp_AntiLambda_Pos;
+    const auto& input_lambdas = is_bkg_channel ? ev.Lambda : ev.AntiLambda;
+    const auto& input_lambdas_neg = is_bkg_channel ? ev.Lambda_Neg : ev.AntiLambda_Neg;
+    const auto& input_lambdas_pos = is_bkg_channel ? ev.Lambda_Pos : ev.AntiLambda_Pos;
     const std::size_t n_lambdas = input_lambdas.size();
     // -- mc
-    const std::vector<POD::Extended::McParticle>* input_mc_lambdas = nullptr;
-    const std::vector<POD::Extended::McParticle>* input_mc_lambdas_neg = nullptr;
-    const std::vector<POD::Extended::McParticle>* input_mc_lambdas_pos = nullptr;
-    if (fSettings.IsMC) {
-        input_mc_lambdas = is_bkg_channel ? &fTemp_MC_Lambda : &fTemp_MC_AntiLambda;
-        input_mc_lambdas_neg = is_bkg_channel ? &fTemp_MC_Lambda_Neg : &fTemp_MC_AntiLambda_Neg;
-        input_mc_lambdas_pos = is_bkg_channel ? &fTemp_MC_Lambda_Pos : &fTemp_MC_AntiLambda_Pos;
+    const std::pmr::vector<POD::Extended::McParticle>* input_mc_lambdas = nullptr;
+    const std::pmr::vector<POD::Extended::McParticle>* input_mc_lambdas_neg = nullptr;
+    const std::pmr::vector<POD::Extended::McParticle>* input_mc_lambdas_pos = nullptr;
+    if constexpr (IsMC) {
+        input_mc_lambdas = is_bkg_channel ? &ev.MC_Lambda : &ev.MC_AntiLambda;
+        input_mc_lambdas_neg = is_bkg_channel ? &ev.MC_Lambda_Neg : &ev.MC_AntiLambda_Neg;
+        input_mc_lambdas_pos = is_bkg_channel ? &ev.MC_Lambda_Pos : &ev.MC_AntiLambda_Pos;
     }
     // kaon-zero-short
     // -- rec
-    const auto& input_k0s = fTemp_KaonZeroShort;
-    const auto& input_k0s_neg = fTemp_KaonZeroShort_Neg;
-    const auto& input_k0s_pos = fTemp_KaonZeroShort_Pos;
+    const auto& input_k0s = ev.KaonZeroShort;
+    const auto& input_k0s_neg = ev.KaonZeroShort_Neg;
+    const auto& input_k0s_pos = ev.KaonZeroShort_Pos;
     const std::size_t n_k0s = input_k0s.size();
     // -- mc
-    const std::vector<POD::Extended::McParticle>* input_mc_k0s = nullptr;
-    const std::vector<POD::Extended::McParticle>* input_mc_k0s_neg = nullptr;
-    const std::vector<POD::Extended::McParticle>* input_mc_k0s_pos = nullptr;
-    if (fSettings.IsMC) {
-        input_mc_k0s = &fTemp_MC_KaonZeroShort;
-        input_mc_k0s_neg = &fTemp_MC_KaonZeroShort_Neg;
-        input_mc_k0s_pos = &fTemp_MC_KaonZeroShort_Pos;
+    const std::pmr::vector<POD::Extended::McParticle>* input_mc_k0s = nullptr;
+    const std::pmr::vector<POD::Extended::McParticle>* input_mc_k0s_neg = nullptr;
+    const std::pmr::vector<POD::Extended::McParticle>* input_mc_k0s_pos = nullptr;
+    if constexpr (IsMC) {
+        input_mc_k0s = &ev.MC_KaonZeroShort;
+        input_mc_k0s_neg = &ev.MC_KaonZeroShort_Neg;
+        input_mc_k0s_pos = &ev.MC_KaonZeroShort_Pos;
     }
-    // cut flow hists
-    TH1D* hist = is_bkg_channel ? fHist_CutFlow_ChannelA_Bkg.get() : fHist_CutFlow_ChannelA.get();
+    // cut flow
+    CutFlow_ChannelA* cut_flow = is_bkg_channel ? &fCutFlow_ChannelA_Bkg : &fCutFlow_ChannelA;
     // daughter hypotheses, which is where the fit reads their masses from
     const DB::Particles::Definition pid_lambda = is_bkg_channel ? DB::Particles::Particle("Lambda") : DB::Particles::Particle("AntiLambda");
     constexpr DB::Particles::Definition pid_k0s = DB::Particles::Particle("KaonZeroShort");
 
+    // background candidates are appended after the signal ones, once both passes are done
+    auto& output = is_bkg_channel ? ev.Output_Bkg : ev.Output;
+
     // determine fit policy
     const KF::FitPolicy fit_policy = GetPolicy_SV();
 
@@ -651,18 +1053,17 @@ void Finder::FindSexaquarks_ChannelA(bool is_bkg_channel) {
     for (std::size_t entry_lambda = 0; entry_lambda < n_lambdas; ++entry_lambda) {
         // cache index lookups //
         const POD::V0& lambda = input_lambdas[entry_lambda];
-        const POD::Track& lambda_neg = input_lambdas_neg[entry_lambda];
-        const POD::Track& lambda_pos = input_lambdas_pos[entry_lambda];
+        const TrackIdx idx_lambda_neg = input_lambdas_neg[entry_lambda];
+        const TrackIdx idx_lambda_pos = input_lambdas_pos[entry_lambda];
 
         for (std::size_t entry_k0s = 0; entry_k0s < n_k0s; ++entry_k0s) {
             // cache index lookups //
             const POD::V0& k0s = input_k0s[entry_k0s];
-            const POD::Track& k0s_neg = input_k0s_neg[entry_k0s];
-            const POD::Track& k0s_pos = input_k0s_pos[entry_k0s];
+            const TrackIdx idx_k0s_neg = input_k0s_neg[entry_k0s];
+            const TrackIdx idx_k0s_pos = input_k0s_pos[entry_k0s];
 
-            // sanity check //
-            if (lambda_neg.EsdEntry == k0s_neg.EsdEntry || lambda_neg.EsdEntry == k0s_pos.EsdEntry || lambda_pos.EsdEntry == k0s_neg.EsdEntry ||
-                lambda_pos.EsdEntry == k0s_pos.EsdEntry) {
+            // sanity check -- same entry, same track //
+            if (idx_lambda_neg == idx_k0s_neg || idx_lambda_neg == idx_k0s_pos || idx_lambda_pos == idx_k0s_neg || idx_lambda_pos == idx_k0s_pos) {
                 continue;
             }
 
@@ -671,7 +1072,7 @@ void Finder::FindSexaquarks_ChannelA(bool is_bkg_channel) {
             auto [seed_lambda, seed_k0s] = Seeder::LineLine::FastPCAs(lambda, k0s, &pca_cache);
 
             // apply cuts (1) //
-            if (!PostSeedCuts_ChannelA(seed_lambda.pca, seed_k0s.pca, hist)) continue;
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostSeedCuts, PostSeedCuts_ChannelA(seed_lambda.pca, seed_k0s.pca, cut_flow))) continue;
 
             // PCAs derivatives //
             auto [deriv_lambda, deriv_k0s] = Seeder::LineLine::ComputeDerivatives(pca_cache);
@@ -681,77 +1082,80 @@ void Finder::FindSexaquarks_ChannelA(bool is_bkg_channel) {
 
             // create storage+computation units //
             POD::Sexaquark sexa = Create_ChannelA(fit, seed_lambda.pca, seed_k0s.pca, is_bkg_channel);
-            Cached::ChannelA c_sexa(sexa, lambda, k0s, fPrimaryVertex);
+            Cached::ChannelA c_sexa(sexa, lambda, k0s, ev.PrimaryVertex);
 
             // apply cuts (2) //
-            if (!PostFitCuts_ChannelA(c_sexa, hist)) continue;
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostFitCuts, PostFitCuts_ChannelA(c_sexa, cut_flow))) continue;
 
             // store reconstructed //
-            fOutput.ChannelA.emplace_back(sexa);
-            fOutput.ChannelA_V0A.emplace_back(lambda);
-            fOutput.ChannelA_V0A_Neg.emplace_back(lambda_neg);
-            fOutput.ChannelA_V0A_Pos.emplace_back(lambda_pos);
-            fOutput.ChannelA_V0B.emplace_back(k0s);
-            fOutput.ChannelA_V0B_Neg.emplace_back(k0s_neg);
-            fOutput.ChannelA_V0B_Pos.emplace_back(k0s_pos);
+            output.ChannelA.emplace_back(sexa);
+            output.ChannelA_V0A.emplace_back(lambda);
+            output.ChannelA_V0A_Neg.emplace_back(ev.Input.Track[idx_lambda_neg]);
+            output.ChannelA_V0A_Pos.emplace_back(ev.Input.Track[idx_lambda_pos]);
+            output.ChannelA_V0B.emplace_back(k0s);
+            output.ChannelA_V0B_Neg.emplace_back(ev.Input.Track[idx_k0s_neg]);
+            output.ChannelA_V0B_Pos.emplace_back(ev.Input.Track[idx_k0s_pos]);
 
             // store mc //
-            if (fSettings.IsMC) {
+            if constexpr (IsMC) {
                 // -- V0A
                 const auto& mc_lambda = (*input_mc_lambdas)[entry_lambda];
-                fOutput.MC_ChannelA_V0A.emplace_back(mc_lambda);
-                fOutput.MC_ChannelA_V0A_Neg.emplace_back((*input_mc_lambdas_neg)[entry_lambda]);
-                fOutput.MC_ChannelA_V0A_Pos.emplace_back((*input_mc_lambdas_pos)[entry_lambda]);
+                output.MC_ChannelA_V0A.emplace_back(mc_lambda);
+                output.MC_ChannelA_V0A_Neg.emplace_back((*input_mc_lambdas_neg)[entry_lambda]);
+                output.MC_ChannelA_V0A_Pos.emplace_back((*input_mc_lambdas_pos)[entry_lambda]);
                 // -- V0B
                 const auto& mc_k0s = (*input_mc_k0s)[entry_k0s];
-                fOutput.MC_ChannelA_V0B.emplace_back(mc_k0s);
-                fOutput.MC_ChannelA_V0B_Neg.emplace_back((*input_mc_k0s_neg)[entry_k0s]);
-                fOutput.MC_ChannelA_V0B_Pos.emplace_back((*input_mc_k0s_pos)[entry_k0s]);
+                output.MC_ChannelA_V0B.emplace_back(mc_k0s);
+                output.MC_ChannelA_V0B_Neg.emplace_back((*input_mc_k0s_neg)[entry_k0s]);
+                output.MC_ChannelA_V0B_Pos.emplace_back((*input_mc_k0s_pos)[entry_k0s]);
                 // -- h-dibaryon
-                fOutput.MC_ChannelA.emplace_back(BuildMcSexaquark(mc_lambda, mc_k0s));
+                output.MC_ChannelA.emplace_back(BuildMcSexaquark(ev, mc_lambda, mc_k0s));
             }
         }
     }
 }
 
-bool Finder::PostSeedCuts_ChannelA(const Seeder::PCA& pca_v0a, const Seeder::PCA& pca_v0b, TH1D* hist_cut_flow) const {
-    FillHist(hist_cut_flow, EChannelA::kAllCombinations);
+template <bool IsMC>
+bool Finder<IsMC>::PostSeedCuts_ChannelA(const Seeder::PCA& pca_v0a, const Seeder::PCA& pca_v0b, CutFlow_ChannelA* cut_flow) const {
+    FillHist(cut_flow, EChannelA::kAllCombinations);
 
     // if (Common::Math::SquaredDistance(pca_v0a.xyz, pca_v0b.xyz) > T2DS::Cuts::ChannelA::Max_DCAbtwV0s * T2DS::Cuts::ChannelA::Max_DCAbtwV0s) {
     // return false;
     // }
-    // FillHist(hist_cut_flow, 1.);
+    // FillHist(cut_flow, 1.);
 
     return true;
 }
 
-bool Finder::PostFitCuts_ChannelA(const Cached::ChannelA& c_sexa, TH1D* hist_cut_flow) const {
+template <bool IsMC>
+bool Finder<IsMC>::PostFitCuts_ChannelA(const Cached::ChannelA& c_sexa, CutFlow_ChannelA* cut_flow) const {
 
     // if (c_sexa.SV_SquaredRadius2D() < Cuts::ChannelA::Min_Radius2D * Cuts::ChannelA::Min_Radius2D) return false;
-    // FillHist(hist_cut_flow, 2.); // PENDING
+    // FillHist(cut_flow, 2.); // PENDING
 
     // if (c_sexa.Dau1_SquaredDCA_wrt_SV() > Cuts::ChannelA::Max_DCALaSV * Cuts::ChannelA::Max_DCALaSV) return false;
-    // FillHist(hist_cut_flow, 3.); // PENDING
+    // FillHist(cut_flow, 3.); // PENDING
 
     // if (c_sexa.Dau2_SquaredDCA_wrt_SV() > Cuts::ChannelA::Max_DCAK0SV * Cuts::ChannelA::Max_DCAK0SV) return false;
-    // FillHist(hist_cut_flow, 4.); // PENDING
+    // FillHist(cut_flow, 4.); // PENDING
 
     // if (c_sexa.CPA_wrt(fInput_Event.PV.X, fInput_Event.PV.Y, fInput_Event.PV.Z) < Cuts::ChannelA::Min_CPAwrtPV) return false;
-    // FillHist(hist_cut_flow, 5.); // PENDING
+    // FillHist(cut_flow, 5.); // PENDING
 
     // if (c_sexa.DCA_wrt(fInput_Event.PV.X, fInput_Event.PV.Y, fInput_Event.PV.Z) > Cuts::ChannelA::Max_DCAwrtPV) return false;
-    // FillHist(hist_cut_flow, 6.); // PENDING
+    // FillHist(cut_flow, 6.); // PENDING
 
     // if (c_sexa.CPA_V0A_SV() < Cuts::ChannelA::Min_La_CPAwrtSV) return false;
-    // FillHist(hist_cut_flow, 7.); // PENDING
+    // FillHist(cut_flow, 7.); // PENDING
 
     // if (c_sexa.CPA_V0B_SV() < Cuts::ChannelA::Min_K0S_CPAwrtSV) return false;
-    // FillHist(hist_cut_flow, 8.); // PENDING
+    // FillHist(cut_flow, 8.); // PENDING
 
     return true;
 }
 
-POD::Sexaquark Finder::Create_ChannelA(const KF::FitResult& fit, const Seeder::PCA& pca_v0a, const Seeder::PCA& pca_v0b, bool is_bkg_channel) {
+template <bool IsMC>
+POD::Sexaquark Finder<IsMC>::Create_ChannelA(const KF::FitResult& fit, const Seeder::PCA& pca_v0a, const Seeder::PCA& pca_v0b, bool is_bkg_channel) {
     POD::Sexaquark sexa;  // non-initialized on purpose
     // candidate info
     sexa.SV_X = static_cast<float>(fit.mother.X());
@@ -786,38 +1190,39 @@ POD::Sexaquark Finder::Create_ChannelA(const KF::FitResult& fit, const Seeder::P
 
 // ## Channel D ZONE ## //
 
-void Finder::FindSexaquarks_ChannelD(bool is_bkg_channel) {
+template <bool IsMC>
+void Finder<IsMC>::FindSexaquarks_ChannelD(EventState& ev, bool is_bkg_channel) {
+
+    Timers::Scoped timer(is_bkg_channel ? Timers::ETimer::ChannelD_Bkg : Timers::ETimer::ChannelD);
+    const auto selection = is_bkg_channel ? Metrics::ESelection::ChannelD_Bkg : Metrics::ESelection::ChannelD;
 
     // determine rules and aliases //
     // (anti)lambda
     // -- rec
-    const auto& input_lambdas = is_bkg_channel ? fTemp_Lambda : fTemp_AntiLambda;
-    const auto& input_lambdas_neg = is_bkg_channel ? fTemp_Lambda_Neg : fTemp_AntiLambda_Neg;
-    const auto& input_lambdas_pos = is_bkg_channel ? fTemp_Lambda_Pos : fTemp_AntiLambda_Pos;
+    const auto& input_lambdas = is_bkg_channel ? ev.Lambda : ev.AntiLambda;
+    const auto& input_lambdas_neg = is_bkg_channel ? ev.Lambda_Neg : ev.AntiLambda_Neg;
+    const auto& input_lambdas_pos = is_bkg_channel ? ev.Lambda_Pos : ev.AntiLambda_Pos;
     const std::size_t n_lambdas = input_lambdas.size();
     // -- mc
-    const std::vector<POD::Extended::McParticle>* input_mc_lambdas = nullptr;
-    const std::vector<POD::Extended::McParticle>* input_mc_lambdas_neg = nullptr;
-    const std::vector<POD::Extended::McParticle>* input_mc_lambdas_pos = nullptr;
-    if (fSettings.IsMC) {
-        input_mc_lambdas = is_bkg_channel ? &fTemp_MC_Lambda : &fTemp_MC_AntiLambda;
-        input_mc_lambdas_neg = is_bkg_channel ? &fTemp_MC_Lambda_Neg : &fTemp_MC_AntiLambda_Neg;
-        input_mc_lambdas_pos = is_bkg_channel ? &fTemp_MC_Lambda_Pos : &fTemp_MC_AntiLambda_Pos;
+    const std::pmr::vector<POD::Extended::McParticle>* input_mc_lambdas = nullptr;
+    const std::pmr::vector<POD::Extended::McParticle>* input_mc_lambdas_neg = nullptr;
+    const std::pmr::vector<POD::Extended::McParticle>* input_mc_lambdas_pos = nullptr;
+    if constexpr (IsMC) {
+        input_mc_lambdas = is_bkg_channel ? &ev.MC_Lambda : &ev.MC_AntiLambda;
+        input_mc_lambdas_neg = is_bkg_channel ? &ev.MC_Lambda_Neg : &ev.MC_AntiLambda_Neg;
+        input_mc_lambdas_pos = is_bkg_channel ? &ev.MC_Lambda_Pos : &ev.MC_AntiLambda_Pos;
     }
     // charged kaon
-    // -- rec
-    const auto& input_kaons = is_bkg_channel ? fTemp_NegKaon : fTemp_PosKaon;
-    const std::size_t n_kaons = input_kaons.size();
-    // -- mc
-    const std::vector<POD::Extended::McParticle>* input_mc_kaons = nullptr;
-    if (fSettings.IsMC) {
-        input_mc_kaons = is_bkg_channel ? &fTemp_MC_NegKaon : &fTemp_MC_PosKaon;
-    }
+    const auto& input_kaons = is_bkg_channel ? ev.NegKaon : ev.PosKaon;
+    const std::size_t n_kaons = input_kaons.Size();
     // daughters' hypotheses
     const DB::Particles::Definition pid_kaon = is_bkg_channel ? DB::Particles::Particle("NegKaon") : DB::Particles::Particle("PosKaon");
     const DB::Particles::Definition pid_lambda = is_bkg_channel ? DB::Particles::Particle("Lambda") : DB::Particles::Particle("AntiLambda");
-    // cut flow hist
-    TH1D* hist = is_bkg_channel ? fHist_CutFlow_ChannelD_Bkg.get() : fHist_CutFlow_ChannelD.get();
+    // cut flow
+    CutFlow_ChannelD* cut_flow = is_bkg_channel ? &fCutFlow_ChannelD_Bkg : &fCutFlow_ChannelD;
+
+    // background candidates are appended after the signal ones, once both passes are done
+    auto& output = is_bkg_channel ? ev.Output_Bkg : ev.Output;
 
     // determine fit policy
     const KF::FitPolicy fit_policy = GetPolicy_SV();
@@ -826,102 +1231,106 @@ void Finder::FindSexaquarks_ChannelD(bool is_bkg_channel) {
     for (std::size_t entry_lambda = 0; entry_lambda < n_lambdas; ++entry_lambda) {
         // cache index lookups //
         const POD::V0& lambda = input_lambdas[entry_lambda];
-        const POD::Track& lambda_neg = input_lambdas_neg[entry_lambda];
-        const POD::Track& lambda_pos = input_lambdas_pos[entry_lambda];
+        const TrackIdx idx_lambda_neg = input_lambdas_neg[entry_lambda];
+        const TrackIdx idx_lambda_pos = input_lambdas_pos[entry_lambda];
 
         for (std::size_t entry_kaon = 0; entry_kaon < n_kaons; ++entry_kaon) {
-            // cache index lookup //
-            const POD::Track& kaon = input_kaons[entry_kaon];
+            const Seeder::TrackView::Row row_kaon = input_kaons[entry_kaon];
+            const TrackIdx idx_kaon = ev.Tracks.entry[row_kaon];
 
-            // -- sanity check
-            if (lambda_neg.EsdEntry == kaon.EsdEntry || lambda_pos.EsdEntry == kaon.EsdEntry) continue;
+            // -- sanity check, same entry, same track
+            if (idx_lambda_neg == idx_kaon || idx_lambda_pos == idx_kaon) continue;
 
             // PCAs (1) //
-            auto [seed_kaon, seed_v0, pca_cache] = Seeder::HelixLine::FastCorrectPCAs(kaon, lambda, fMagneticField);
+            auto [seed_kaon, seed_v0, pca_cache] = Seeder::HelixLine::FastCorrectPCAs(ev.Tracks, row_kaon, lambda);
 
             // apply cuts (1) //
-            if (!PostSeedCuts_ChannelD(seed_v0.pca, seed_kaon.pca, hist)) continue;
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostSeedCuts, PostSeedCuts_ChannelD(seed_v0.pca, seed_kaon.pca, cut_flow))) continue;
 
             // PCAs derivatives //
             auto [deriv_ka, deriv_v0] = Seeder::HelixLine::ComputeDerivatives(seed_kaon, seed_v0, pca_cache);
 
             // fit vertex //
-            auto fit = KF::FitVertex(kaon, lambda, pid_kaon, pid_lambda, {seed_kaon, deriv_ka}, {seed_v0, deriv_v0}, fMagneticField, fit_policy);
+            auto fit = KF::FitVertex(ev.Tracks, row_kaon, lambda, pid_kaon, pid_lambda, {seed_kaon, deriv_ka}, {seed_v0, deriv_v0},
+                                     ev.MagneticField, fit_policy);
 
             // create storage+computation units //
             POD::Sexaquark sexa = Create_ChannelD(fit, seed_v0.pca, seed_kaon.pca, is_bkg_channel);
-            Cached::ChannelD c_sexa(sexa, lambda, fPrimaryVertex);
+            Cached::ChannelD c_sexa(sexa, lambda, ev.PrimaryVertex);
 
             // apply cuts (2) //
-            if (!PostFitCuts_ChannelD(c_sexa, hist)) continue;
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostFitCuts, PostFitCuts_ChannelD(c_sexa, cut_flow))) continue;
 
             // store reconstructed //
-            fOutput.ChannelD.emplace_back(sexa);
-            fOutput.ChannelD_V0.emplace_back(lambda);
-            fOutput.ChannelD_V0_Neg.emplace_back(lambda_neg);
-            fOutput.ChannelD_V0_Pos.emplace_back(lambda_pos);
-            fOutput.ChannelD_Kaon.emplace_back(kaon);
+            output.ChannelD.emplace_back(sexa);
+            output.ChannelD_V0.emplace_back(lambda);
+            output.ChannelD_V0_Neg.emplace_back(ev.Input.Track[idx_lambda_neg]);
+            output.ChannelD_V0_Pos.emplace_back(ev.Input.Track[idx_lambda_pos]);
+            output.ChannelD_Kaon.emplace_back(ev.Tracks.Track(row_kaon));
 
             // store mc //
-            if (fSettings.IsMC) {
+            if constexpr (IsMC) {
                 // -- V0
                 const auto& mc_lambda = (*input_mc_lambdas)[entry_lambda];
-                fOutput.MC_ChannelD_V0.emplace_back(mc_lambda);
-                fOutput.MC_ChannelD_V0_Neg.emplace_back((*input_mc_lambdas_neg)[entry_lambda]);
-                fOutput.MC_ChannelD_V0_Pos.emplace_back((*input_mc_lambdas_pos)[entry_lambda]);
+                output.MC_ChannelD_V0.emplace_back(mc_lambda);
+                output.MC_ChannelD_V0_Neg.emplace_back((*input_mc_lambdas_neg)[entry_lambda]);
+                output.MC_ChannelD_V0_Pos.emplace_back((*input_mc_lambdas_pos)[entry_lambda]);
                 // -- Kaon
-                const auto& mc_kaon = (*input_mc_kaons)[entry_kaon];
-                fOutput.MC_ChannelD_Kaon.emplace_back(mc_kaon);
+                const auto& mc_kaon = McTrack(ev, idx_kaon, pid_kaon.pdg_code);
+                output.MC_ChannelD_Kaon.emplace_back(mc_kaon);
                 // -- h-dibaryon
-                fOutput.MC_ChannelD.emplace_back(BuildMcSexaquark(mc_lambda, mc_kaon));
+                output.MC_ChannelD.emplace_back(BuildMcSexaquark(ev, mc_lambda, mc_kaon));
             }
         }
     }
 }
 
-bool Finder::PostSeedCuts_ChannelD(const Seeder::PCA& pca_v0, const Seeder::PCA& pca_ka, TH1D* hist_cut_flow) const {
-    FillHist(hist_cut_flow, EChannelD::kAllCombinations);
+template <bool IsMC>
+bool Finder<IsMC>::PostSeedCuts_ChannelD(const Seeder::PCA& pca_v0, const Seeder::PCA& pca_ka, CutFlow_ChannelD* cut_flow) const {
+    FillHist(cut_flow, EChannelD::kAllCombinations);
 
     // if (Common::Math::SquaredDistance(pca_ka.xyz, pca_v0.xyz) > Cuts::ChannelD::Max_DCAKaLa * Cuts::ChannelD::Max_DCAKaLa) return false;
-    // FillHist(hist_cut_flow, 1.); // PENDING
+    // FillHist(cut_flow, 1.); // PENDING
 
     return true;
 }
 
-bool Finder::PostFitCuts_ChannelD(const Cached::ChannelD& c_sexa, TH1D* hist_cut_flow) const {
+template <bool IsMC>
+bool Finder<IsMC>::PostFitCuts_ChannelD(const Cached::ChannelD& c_sexa, CutFlow_ChannelD* cut_flow) const {
 
     // double sq_radius_2d = c_sexa.SV_SquaredRadius2D();
     // if (sq_radius_2d < Cuts::ChannelD::Min_Radius2D * Cuts::ChannelD::Min_Radius2D ||
     // sq_radius_2d > Cuts::ChannelD::Max_Radius2D * Cuts::ChannelD::Max_Radius2D) {
     // return false;
     // }
-    // FillHist(hist_cut_flow, 2.); // PENDING
+    // FillHist(cut_flow, 2.); // PENDING
 
     // if (sexa.AbsRapidity_MinusNucleon() > Cuts::ChannelD::AbsMax_Rapidity) return false;  // PENDING: kinematics, affected by Fermi motion
-    // FillHist(hist_cut_flow, 3.); // PENDING
+    // FillHist(cut_flow, 3.); // PENDING
 
     // if (sexa.CPA_Vertex(fInput_Event.PV.X, fInput_Event.PV.Y, fInput_Event.PV.Z) < Cuts::ChannelD::Min_CPAwrtPV ||
     // sexa.CPA_Vertex(fInput_Event.PV.X, fInput_Event.PV.Y, fInput_Event.PV.Z) > Cuts::ChannelD::Max_CPAwrtPV) {
     // return false;  // PENDING: kinematics, affected by Fermi motion
     // }
-    // FillHist(hist_cut_flow, 3.); // PENDING
+    // FillHist(cut_flow, 3.); // PENDING
 
     // if (c_sexa.Dau1_SquaredDCA_wrt_SV() > Cuts::ChannelD::Max_DCALaSV * Cuts::ChannelD::Max_DCALaSV) return false;
-    // FillHist(hist_cut_flow, 4.); // PENDING
+    // FillHist(cut_flow, 4.); // PENDING
 
     // if (c_sexa.Dau2_SquaredDCA_wrt_SV() > Cuts::ChannelD::Max_DCAKaSV * Cuts::ChannelD::Max_DCAKaSV) return false;
-    // FillHist(hist_cut_flow, 5.); // PENDING
+    // FillHist(cut_flow, 5.); // PENDING
 
     // if (sexa.DCA_V0Neg_wrt_SV(fInput_Event.MagneticField) > Cuts::ChannelD::Max_DCALaNegSV) return false;
-    // FillHist(hist_cut_flow, 6.); // PENDING
+    // FillHist(cut_flow, 6.); // PENDING
 
     // if (sexa.DCA_V0Pos_wrt_SV(fInput_Event.MagneticField) > Cuts::ChannelD::Max_DCALaPosSV) return false;
-    // FillHist(hist_cut_flow, 7.); // PENDING
+    // FillHist(cut_flow, 7.); // PENDING
 
     return true;
 }
 
-POD::Sexaquark Finder::Create_ChannelD(const KF::FitResult& fit, const Seeder::PCA& pca_v0, const Seeder::PCA& pca_ka, bool is_bkg_channel) {
+template <bool IsMC>
+POD::Sexaquark Finder<IsMC>::Create_ChannelD(const KF::FitResult& fit, const Seeder::PCA& pca_v0, const Seeder::PCA& pca_ka, bool is_bkg_channel) {
     POD::Sexaquark sexa;  // non-initialized on purpose
     // candidate info
     sexa.SV_X = static_cast<float>(fit.mother.X());
@@ -956,88 +1365,96 @@ POD::Sexaquark Finder::Create_ChannelD(const KF::FitResult& fit, const Seeder::P
 
 // ## Channel H ZONE ## //
 
-void Finder::FindSexaquarks_ChannelH(bool is_bkg_channel) {
+template <bool IsMC>
+void Finder<IsMC>::FindSexaquarks_ChannelH(EventState& ev, bool is_bkg_channel) {
+
+    Timers::Scoped timer(is_bkg_channel ? Timers::ETimer::ChannelH_Bkg : Timers::ETimer::ChannelH);
+    const auto selection = is_bkg_channel ? Metrics::ESelection::ChannelH_Bkg : Metrics::ESelection::ChannelH;
 
     // determine rules and aliases //
     // charged kaons
-    // -- rec
-    const auto& input_kaons = is_bkg_channel ? fTemp_NegKaon : fTemp_PosKaon;
-    const std::size_t n_kaons = input_kaons.size();
-    // -- mc
-    const std::vector<POD::Extended::McParticle>* input_mc_kaons = nullptr;
-    if (fSettings.IsMC) input_mc_kaons = is_bkg_channel ? &fTemp_MC_NegKaon : &fTemp_MC_PosKaon;
+    const auto& input_kaons = is_bkg_channel ? ev.NegKaon : ev.PosKaon;
+    const std::size_t n_kaons = input_kaons.Size();
     // daughter hypothesis, which is where the fit reads their mass from
     const DB::Particles::Definition pid_kaon = is_bkg_channel ? DB::Particles::Particle("NegKaon") : DB::Particles::Particle("PosKaon");
-    // cut flow hist
-    TH1D* hist = is_bkg_channel ? fHist_CutFlow_ChannelH_Bkg.get() : fHist_CutFlow_ChannelH.get();
+    // cut flow
+    CutFlow_ChannelH* cut_flow = is_bkg_channel ? &fCutFlow_ChannelH_Bkg : &fCutFlow_ChannelH;
+
+    // background candidates are appended after the signal ones, once both passes are done
+    auto& output = is_bkg_channel ? ev.Output_Bkg : ev.Output;
 
     // determine fit policy
     const KF::FitPolicy fit_policy = GetPolicy_SV();
 
     // loop over all possible pairs of (pos)kaon+(pos)kaon or (neg)kaon+(neg)kaon //
     for (std::size_t entry_kaon1 = 0; entry_kaon1 + 1 < n_kaons; ++entry_kaon1) {
-        const POD::Track& kaon1 = input_kaons[entry_kaon1];  // cache index lookup
+        const Seeder::TrackView::Row row_kaon1 = input_kaons[entry_kaon1];
 
         for (std::size_t entry_kaon2 = entry_kaon1 + 1; entry_kaon2 < n_kaons; ++entry_kaon2) {
+            const Seeder::TrackView::Row row_kaon2 = input_kaons[entry_kaon2];
             // NOTE: sanity check not needed, because loops don't intersect
-            const POD::Track& kaon2 = input_kaons[entry_kaon2];  // cache index lookup
 
             // PCAs (1) //
-            auto [seed_kaon1, seed_kaon2, pca_cache] = Seeder::HelixHelix::FastCorrectPCAs(kaon1, kaon2, fMagneticField);
+            auto [seed_kaon1, seed_kaon2, pca_cache] = Seeder::HelixHelix::FastCorrectPCAs(ev.Tracks, row_kaon1, ev.Tracks, row_kaon2);
 
             // apply cuts (1) //
-            if (!PostSeedCuts_ChannelH(seed_kaon1.pca, seed_kaon2.pca, hist)) continue;
+            const bool passes_seed_cuts = PostSeedCuts_ChannelH(seed_kaon1.pca, seed_kaon2.pca, cut_flow);
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostSeedCuts, passes_seed_cuts)) continue;
 
             // PCAs derivatives //
             auto [deriv_kaon1, deriv_kaon2] = Seeder::HelixHelix::ComputeDerivatives(seed_kaon1, seed_kaon2, pca_cache);
 
             // fit vertex //
-            auto fit =
-                KF::FitVertex(kaon1, kaon2, pid_kaon, pid_kaon, {seed_kaon1, deriv_kaon1}, {seed_kaon2, deriv_kaon2}, fMagneticField, fit_policy);
+            auto fit = KF::FitVertex(ev.Tracks, row_kaon1, ev.Tracks, row_kaon2, pid_kaon, pid_kaon, {seed_kaon1, deriv_kaon1},
+                                     {seed_kaon2, deriv_kaon2}, ev.MagneticField, fit_policy);
 
             // create storage+computation units //
             POD::Sexaquark sexa = Create_ChannelH(fit, seed_kaon1.pca, seed_kaon2.pca, is_bkg_channel);
-            Cached::ChannelH c_sexa(sexa, fPrimaryVertex);
+            Cached::ChannelH c_sexa(sexa, ev.PrimaryVertex);
 
             // apply cuts (2) //
-            if (!PostFitCuts_ChannelH(c_sexa, hist)) continue;
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostFitCuts, PostFitCuts_ChannelH(c_sexa, cut_flow))) continue;
 
             // store reconstructed //
-            fOutput.ChannelH.emplace_back(sexa);
-            fOutput.ChannelH_Kaon1.emplace_back(kaon1);
-            fOutput.ChannelH_Kaon2.emplace_back(kaon2);
+            output.ChannelH.emplace_back(sexa);
+            output.ChannelH_Kaon1.emplace_back(ev.Tracks.Track(row_kaon1));
+            output.ChannelH_Kaon2.emplace_back(ev.Tracks.Track(row_kaon2));
 
             // store mc //
-            if (fSettings.IsMC) {
+            if constexpr (IsMC) {
                 // -- Kaon1
-                const auto& mc_kaon1 = (*input_mc_kaons)[entry_kaon1];
-                fOutput.MC_ChannelH_Kaon1.emplace_back(mc_kaon1);
+                const auto& mc_kaon1 = McTrack(ev, ev.Tracks.entry[row_kaon1], pid_kaon.pdg_code);
+                output.MC_ChannelH_Kaon1.emplace_back(mc_kaon1);
                 // -- Kaon2
-                const auto& mc_kaon2 = (*input_mc_kaons)[entry_kaon2];
-                fOutput.MC_ChannelH_Kaon2.emplace_back(mc_kaon2);
+                const auto& mc_kaon2 = McTrack(ev, ev.Tracks.entry[row_kaon2], pid_kaon.pdg_code);
+                output.MC_ChannelH_Kaon2.emplace_back(mc_kaon2);
                 // -- h-dibaryon
-                fOutput.MC_ChannelH.emplace_back(BuildMcSexaquark(mc_kaon1, mc_kaon2));
+                output.MC_ChannelH.emplace_back(BuildMcSexaquark(ev, mc_kaon1, mc_kaon2));
             }
         }
     }
 }
 
-bool Finder::PostSeedCuts_ChannelH(const Seeder::PCA& pca_kaon1, const Seeder::PCA& pca_kaon2, TH1D* hist_cut_flow) const {
-    FillHist(hist_cut_flow, EChannelH::kAllCombinations);
+template <bool IsMC>
+bool Finder<IsMC>::PostSeedCuts_ChannelH(const Seeder::PCA& pca_kaon1, const Seeder::PCA& pca_kaon2, CutFlow_ChannelH* cut_flow) const {
+    FillHist(cut_flow, EChannelH::kAllCombinations);
 
     // PENDING //
 
     return true;
 }
 
-bool Finder::PostFitCuts_ChannelH(const Cached::ChannelH& c_sexa, TH1D* hist_cut_flow) const {
+template <bool IsMC>
+bool Finder<IsMC>::PostFitCuts_ChannelH(const Cached::ChannelH& c_sexa, CutFlow_ChannelH* cut_flow) const {
 
     // PENDING //
 
     return true;
 }
 
-POD::Sexaquark Finder::Create_ChannelH(const KF::FitResult& fit, const Seeder::PCA& pca_kaon1, const Seeder::PCA& pca_kaon2, bool is_bkg_channel) {
+template <bool IsMC>
+POD::Sexaquark Finder<IsMC>::Create_ChannelH(const KF::FitResult& fit, const Seeder::PCA& pca_kaon1, const Seeder::PCA& pca_kaon2,
+                                             bool is_bkg_channel) {
     POD::Sexaquark sexa;  // non-initialized on purpose
     // candidate info
     sexa.SV_X = static_cast<float>(fit.mother.X());
@@ -1072,56 +1489,75 @@ POD::Sexaquark Finder::Create_ChannelH(const KF::FitResult& fit, const Seeder::P
 
 // ## END OF CYCLES ## //
 
-void Finder::EndOfEvent() {
+template <bool IsMC>
+void Finder<IsMC>::EndOfEvent(EventState& ev) {
 
     // in case of data, don't keep event with no candidates
-    const bool has_rec_candidates = !fOutput.ChannelA.empty() || !fOutput.ChannelD.empty() || !fOutput.ChannelH.empty();
+    const bool has_rec_candidates = !ev.Output.ChannelA.empty() || !ev.Output.ChannelD.empty() || !ev.Output.ChannelH.empty();
     // in case of MC, keep event with injected or reconstructed candidates
-    const bool has_injected = fSettings.IsMC && !fOutput.Injected.empty();
+    const bool has_injected = IsMC && !ev.Output.Injected.empty();
+
+    if (has_rec_candidates || has_injected) {
+        // the writer is bound to `fOutput`, hence the swaps
+        std::swap(fOutput, ev.Output);
+        {
+            Timers::Scoped timer(Timers::ETimer::WriterFill);
+            fWriter->Fill();
+        }
+        std::swap(fOutput, ev.Output);
+    }
+
+    ev.Clear();
+}
 
-    if (has_rec_candidates || has_injected) fWriter->Fill();
-    fOutput.Clear(fSettings.IsMC);
+template <bool IsMC>
+void Finder<IsMC>::EventState::Clear() {
 
-    // clear transient tracks //
-    fTemp_AntiProton.clear();
-    fTemp_Proton.clear();
-    fTemp_NegKaon.clear();
-    fTemp_PosKaon.clear();
-    fTemp_PiMinus.clear();
-    fTemp_PiPlus.clear();
+    Output.Clear(IsMC);
+    Output_Bkg.Clear(IsMC);
+
+    // clear transient track lists //
+    Tracks.Clear();
+    Drop(AntiProton.rows);
+    Drop(Proton.rows);
+    Drop(NegKaon.rows);
+    Drop(PosKaon.rows);
+    Drop(PiMinus.rows);
+    Drop(PiPlus.rows);
+    SharedV0Pairs.Clear();
+    Drop(PendingV0Pairs);
 
     // clear transient v0s //
-    fTemp_AntiLambda.clear();
-    fTemp_AntiLambda_Neg.clear();
-    fTemp_AntiLambda_Pos.clear();
-    fTemp_Lambda.clear();
-    fTemp_Lambda_Neg.clear();
-    fTemp_Lambda_Pos.clear();
-    fTemp_KaonZeroShort.clear();
-    fTemp_KaonZeroShort_Neg.clear();
-    fTemp_KaonZeroShort_Pos.clear();
-
-    if (!fSettings.IsMC) return;
+    Drop(AntiLambda);
+    Drop(AntiLambda_Neg);
+    Drop(AntiLambda_Pos);
+    Drop(Lambda);
+    Drop(Lambda_Neg);
+    Drop(Lambda_Pos);
+    Drop(KaonZeroShort);
+    Drop(KaonZeroShort_Neg);
+    Drop(KaonZeroShort_Pos);
 
     // clear transient mc //
-    fTemp_MC_AntiProton.clear();
-    fTemp_MC_Proton.clear();
-    fTemp_MC_NegKaon.clear();
-    fTemp_MC_PosKaon.clear();
-    fTemp_MC_PiMinus.clear();
-    fTemp_MC_PiPlus.clear();
-    fTemp_MC_AntiLambda.clear();
-    fTemp_MC_AntiLambda_Neg.clear();
-    fTemp_MC_AntiLambda_Pos.clear();
-    fTemp_MC_Lambda.clear();
-    fTemp_MC_Lambda_Neg.clear();
-    fTemp_MC_Lambda_Pos.clear();
-    fTemp_MC_KaonZeroShort.clear();
-    fTemp_MC_KaonZeroShort_Neg.clear();
-    fTemp_MC_KaonZeroShort_Pos.clear();
+    if constexpr (IsMC) {
+        MC_Tracks.Clear();
+        Drop(MC_AntiLambda);
+        Drop(MC_AntiLambda_Neg);
+        Drop(MC_AntiLambda_Pos);
+        Drop(MC_Lambda);
+        Drop(MC_Lambda_Neg);
+        Drop(MC_Lambda_Pos);
+        Drop(MC_KaonZeroShort);
+        Drop(MC_KaonZeroShort_Neg);
+        Drop(MC_KaonZeroShort_Pos);
+    }
+
+    // -- every container above gave its storage back, thus the whole event is released at once
+    Memory.Release();
 }
 
-bool Finder::EndOfAnalysis() {
+template <bool IsMC>
+bool Finder<IsMC>::EndOfAnalysis() {
 
     Logger::Info(__FUNCTION__, "The following objects have been written into TFile \"{}\":", fSettings.PathOutputFile);
 
@@ -1129,6 +1565,22 @@ bool Finder::EndOfAnalysis() {
 
     // write histograms //
 
+    fCutFlow_AntiProton.Fold();
+    fCutFlow_Proton.Fold();
+    fCutFlow_NegKaon.Fold();
+    fCutFlow_PosKaon.Fold();
+    fCutFlow_PiMinus.Fold();
+    fCutFlow_PiPlus.Fold();
+    fCutFlow_AntiLambda.Fold();
+    fCutFlow_Lambda.Fold();
+    fCutFlow_KaonZeroShort.Fold();
+    fCutFlow_ChannelA.Fold();
+    fCutFlow_ChannelA_Bkg.Fold();
+    fCutFlow_ChannelD.Fold();
+    fCutFlow_ChannelD_Bkg.Fold();
+    fCutFlow_ChannelH.Fold();
+    fCutFlow_ChannelH_Bkg.Fold();
+
     fOutput_File->cd();
     for (auto* hist : {
              fHist_EventCounter.get(),
@@ -1157,4 +1609,9 @@ bool Finder::EndOfAnalysis() {
     return fHist_EventCounter->GetEntries() != 0;
 }
 
+// ## Instantiations ZONE ## //
+
+template class Finder<false>;
+template class Finder<true>;
+
 }  // namespace T2DS
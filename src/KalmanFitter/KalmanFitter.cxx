@@ -8,10 +8,10 @@
 #include "Seeder/BaseSeeder.hxx"
 #include "Seeder/SeederHelixVertex.hxx"
 #include "Seeder/SeederLineVertex.hxx"
-#if T2DS_DEBUG
+
 #include "App/Logger.hxx"
+#include "App/Timers.hxx"
 #include "App/Utilities.hxx"
-#endif
 
 #include "KalmanFitter/BaseKalmanFitter.hxx"
 
@@ -85,10 +85,10 @@ void Daughter::PrepareJacobAndCorr(const Seeder::Result& s, double bz) {
 
     corr = df_ds * ds_dr1;
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "jacob  = {}", jacob);
-    Logger::Debug(__FUNCTION__, "corr   = {}", corr);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "jacob  = {}", jacob);
+        Logger::Debug(__FUNCTION__, "corr   = {}", corr);
+    }
 }
 
 // Transport particle.
@@ -116,10 +116,10 @@ void Daughter::Transport(const Seeder::PCA& pca, const Eigen::Ref<const Eigen::M
     // -- with corr. matrix + other particle's cov matrix
     fC.block<6, 6>(0, 0).noalias() += corr * other_bt_cov.block<6, 6>(0, 0).selfadjointView<Eigen::Lower>() * corr.transpose();
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "fP = {}", fP);
-    Logger::Debug(__FUNCTION__, "fC = {}", fC);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "fP = {}", fP);
+        Logger::Debug(__FUNCTION__, "fC = {}", fC);
+    }
 }
 
 // == Mass Constraint == //
@@ -375,17 +375,17 @@ KF::Particle SetProductionVertex(const KF::Particle& part, const KF::Vertex& vtx
     out.fChi2 += dchi2;
     out.fNDF += 2;
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "mS     = {}", mS);
-    Logger::Debug(__FUNCTION__, "res    = {}", res);
-    Logger::Debug(__FUNCTION__, "mK     = {}", mK);
-    Logger::Debug(__FUNCTION__, "mD     = {}", mD);
-    Logger::Debug(__FUNCTION__, "mG     = {}", mG);
-    Logger::Debug(__FUNCTION__, "M      = {}", M);
-    Logger::Debug(__FUNCTION__, "dchi2  = {:13.6e}", dchi2);
-    Logger::Debug(__FUNCTION__, "out.fP = {}", out.fP);
-    Logger::Debug(__FUNCTION__, "out.fC = {}", out.fC);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "mS     = {}", mS);
+        Logger::Debug(__FUNCTION__, "res    = {}", res);
+        Logger::Debug(__FUNCTION__, "mK     = {}", mK);
+        Logger::Debug(__FUNCTION__, "mD     = {}", mD);
+        Logger::Debug(__FUNCTION__, "mG     = {}", mG);
+        Logger::Debug(__FUNCTION__, "M      = {}", M);
+        Logger::Debug(__FUNCTION__, "dchi2  = {:13.6e}", dchi2);
+        Logger::Debug(__FUNCTION__, "out.fP = {}", out.fP);
+        Logger::Debug(__FUNCTION__, "out.fC = {}", out.fC);
+    }
 
     return out;
 }
@@ -462,20 +462,20 @@ KF::FitResult GetUpdated(const KF::Daughter& kf_1, const KF::Daughter& kf_2) {
     out.fMassHypo = std::nullopt;
     out.fSumDaughterMass = kf_1.fSumDaughterMass + kf_2.fSumDaughterMass;
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "mS     = {}", mS);
-    Logger::Debug(__FUNCTION__, "zeta   = {}", zeta);
-    Logger::Debug(__FUNCTION__, "mCHt   = {}", mCHt);
-    Logger::Debug(__FUNCTION__, "mK     = {}", mK);
-    Logger::Debug(__FUNCTION__, "mSz    = {}", mSz);
-    Logger::Debug(__FUNCTION__, "D      = {}", D);
-    Logger::Debug(__FUNCTION__, "K      = {}", K);
-    Logger::Debug(__FUNCTION__, "K2     = {}", K2);
-    Logger::Debug(__FUNCTION__, "A      = {}", A);
-    Logger::Debug(__FUNCTION__, "M      = {}", M);
-    Logger::Debug(__FUNCTION__, "out.fP = {}", out.fP);
-    Logger::Debug(__FUNCTION__, "out.fC = {}", out.fC);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "mS     = {}", mS);
+        Logger::Debug(__FUNCTION__, "zeta   = {}", zeta);
+        Logger::Debug(__FUNCTION__, "mCHt   = {}", mCHt);
+        Logger::Debug(__FUNCTION__, "mK     = {}", mK);
+        Logger::Debug(__FUNCTION__, "mSz    = {}", mSz);
+        Logger::Debug(__FUNCTION__, "D      = {}", D);
+        Logger::Debug(__FUNCTION__, "K      = {}", K);
+        Logger::Debug(__FUNCTION__, "K2     = {}", K2);
+        Logger::Debug(__FUNCTION__, "A      = {}", A);
+        Logger::Debug(__FUNCTION__, "M      = {}", M);
+        Logger::Debug(__FUNCTION__, "out.fP = {}", out.fP);
+        Logger::Debug(__FUNCTION__, "out.fC = {}", out.fC);
+    }
 
     return res;
 }
@@ -590,22 +590,22 @@ KF::FitResult GetUpdatedMC(const KF::Daughter& kf_1, const KF::Daughter& kf_2) {
     out.fMassHypo = std::nullopt;
     out.fSumDaughterMass = kf_1.fSumDaughterMass + kf_2.fSumDaughterMass;
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "mS     = {}", mS);
-    Logger::Debug(__FUNCTION__, "zeta   = {}", zeta);
-    Logger::Debug(__FUNCTION__, "mCHt   = {}", mCHt);
-    Logger::Debug(__FUNCTION__, "mVHt   = {}", mVHt);
-    Logger::Debug(__FUNCTION__, "mK     = {}", mK);
-    Logger::Debug(__FUNCTION__, "mSz    = {}", mSz);
-    Logger::Debug(__FUNCTION__, "mKm    = {}", mKm);
-    Logger::Debug(__FUNCTION__, "mJ1    = {}", mJ1);
-    Logger::Debug(__FUNCTION__, "mJ2    = {}", mJ2);
-    Logger::Debug(__FUNCTION__, "mDf    = {}", mDf);
-    Logger::Debug(__FUNCTION__, "D      = {}", D);
-    Logger::Debug(__FUNCTION__, "M      = {}", M);
-    Logger::Debug(__FUNCTION__, "out.fP = {}", out.fP);
-    Logger::Debug(__FUNCTION__, "out.fC = {}", out.fC);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "mS     = {}", mS);
+        Logger::Debug(__FUNCTION__, "zeta   = {}", zeta);
+        Logger::Debug(__FUNCTION__, "mCHt   = {}", mCHt);
+        Logger::Debug(__FUNCTION__, "mVHt   = {}", mVHt);
+        Logger::Debug(__FUNCTION__, "mK     = {}", mK);
+        Logger::Debug(__FUNCTION__, "mSz    = {}", mSz);
+        Logger::Debug(__FUNCTION__, "mKm    = {}", mKm);
+        Logger::Debug(__FUNCTION__, "mJ1    = {}", mJ1);
+        Logger::Debug(__FUNCTION__, "mJ2    = {}", mJ2);
+        Logger::Debug(__FUNCTION__, "mDf    = {}", mDf);
+        Logger::Debug(__FUNCTION__, "D      = {}", D);
+        Logger::Debug(__FUNCTION__, "M      = {}", M);
+        Logger::Debug(__FUNCTION__, "out.fP = {}", out.fP);
+        Logger::Debug(__FUNCTION__, "out.fC = {}", out.fC);
+    }
 
     return res;
 }
@@ -613,6 +613,8 @@ KF::FitResult GetUpdatedMC(const KF::Daughter& kf_1, const KF::Daughter& kf_2) {
 KF::FitResult FitVertex(const KF::Particle& part_1, const KF::Particle& part_2, const Seeder::Result& s_1, const Seeder::Result& s_2, double bz,
                         const FitPolicy& policy) {
 
+    Timers::Scoped timer(Timers::ETimer::FitVertex);
+
     KF::Daughter kf_1(part_1);
     KF::Daughter kf_2(part_2);
 
@@ -10,6 +10,7 @@
 #include "common/POD_V0.hpp"
 
 #include "KalmanFitter/BaseKalmanFitter.hxx"
+#include "Seeder/TrackStore.hxx"
 
 #include "KalmanFitter/KalmanFitterParticle.hxx"
 
@@ -31,25 +32,25 @@ void Particle::SetMassBookkeeping(const DB::Particles::Definition& pid, bool on_
     fSumDaughterMass = fMassHypo.value_or(DB::Particles::SumDaughterMass(pid));
 }
 
-// Create a `KF::Particle`, by setting `fP`, `fC` and `fQ` from a track.
-Particle Particle::FromTrack(const POD::Track& v, const DB::Particles::Definition& pid) {
+// Create a `KF::Particle`, by setting `fP`, `fC` and `fQ` from the kinematics and covariance of a track.
+Particle Particle::FromTrack(const Seeder::TrackState& v, const TrackCovMatrix& cov, const DB::Particles::Definition& pid) {
 
     const double mass = pid.mass;
 
     Particle out;
 
-    out.fP(0) = static_cast<double>(v.X);
-    out.fP(1) = static_cast<double>(v.Y);
-    out.fP(2) = static_cast<double>(v.Z);
-    out.fP(3) = static_cast<double>(v.Px);
-    out.fP(4) = static_cast<double>(v.Py);
-    out.fP(5) = static_cast<double>(v.Pz);
+    out.fP(0) = v.x;
+    out.fP(1) = v.y;
+    out.fP(2) = v.z;
+    out.fP(3) = v.px;
+    out.fP(4) = v.py;
+    out.fP(5) = v.pz;
     out.fP(6) = std::sqrt(mass * mass + out.SquaredMomentum());
     out.fP(7) = 0.;
 
     for (unsigned int i = 0; i < 6; ++i) {
         for (unsigned int j = 0; j <= i; ++j) {
-            out.fC(i, j) = static_cast<double>(v.CovMatrix[IJ(i, j)]);
+            out.fC(i, j) = static_cast<double>(cov[IJ(i, j)]);
         }
     }
 
@@ -71,13 +72,17 @@ Particle Particle::FromTrack(const POD::Track& v, const DB::Particles::Definitio
                     2 * (h0 * h1 * out.fC(4, 3) + h0 * h2 * out.fC(5, 3) + h1 * h2 * out.fC(5, 4)));
     out.fC(7, 7) = Initial_Css;
 
-    out.fQ = v.Charge;
+    out.fQ = static_cast<int>(v.charge);
 
     out.SetMassBookkeeping(pid, true);
 
     return out;
 }
 
+Particle Particle::FromTrack(const POD::Track& v, const DB::Particles::Definition& pid) {
+    return FromTrack(Seeder::TrackState::FromTrack(v), v.CovMatrix, pid);
+}
+
 // Create a `KF::Particle`, by setting `fP`, `fC` and `fQ` from a V0 view.
 Particle Particle::FromV0(const POD::V0& v, const DB::Particles::Definition& pid, bool on_shell) {
 
@@ -1,15 +1,20 @@
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 #include "common/Constants.hpp"
 #include "common/Math.hpp"
-#include "common/POD_Track.hpp"
 
 #include "Seeder/BaseSeeder.hxx"
-#if T2DS_DEBUG
+#include "Seeder/Simd.hxx"
+#include "Seeder/TrackStore.hxx"
 #include "App/Logger.hxx"
-#endif
 
 #include "Seeder/SeederHelixHelix.hxx"
 
@@ -18,39 +23,39 @@ namespace T2DS::Seeder::HelixHelix {
 // First phase. Find the points of closest approach (PCA) of two particles in the XY plane.
 // Both particles are charged and under a constant magnetic field. Assume helical trajectories.
 // Arguments:
-// - `q1`    -- [input] first particle
-// - `q2`    -- [input] second particle
-// - `bz`    -- [input] z-component of homogeneous magnetic field
+// - `h1`    -- [input] helix of first particle
+// - `h2`    -- [input] helix of second particle
 // - `cache` -- [output,optional] useful struct to store intermediate results for next phases
 // Return: (packed as a pair of `Seed` structs)
 // - `ds`  -- transport parameters
 // - `pca` -- points of closest approach (position and momentum)
 // - `theta`, `sin`, `cos`, `sB`, `cB` -- cached ds computation variables
-std::pair<Seed, Seed> FastPCAs_XY(const POD::Track& q1, const POD::Track& q2, double bz, Cache* cache) {
+// NOTE: single-track terms come precomputed in `HelixParams`, only the pairwise ones are computed here
+std::pair<Seed, Seed> FastPCAs_XY(const HelixParams& h1, const HelixParams& h2, Cache* cache) {
 
     // cache //
 
     Cache local;
     Cache& c = cache != nullptr ? *cache : local;
 
-    c.bq1 = bz * static_cast<double>(q1.Charge) * Common::Kappa;
-    c.bq2 = bz * static_cast<double>(q2.Charge) * Common::Kappa;
-
-    c.x01 = q1.X;
-    c.y01 = q1.Y;
-    c.z01 = q1.Z;
-    c.px01 = q1.Px;
-    c.py01 = q1.Py;
-    c.pz01 = q1.Pz;
-    c.pt12 = c.px01 * c.px01 + c.py01 * c.py01;
-
-    c.x02 = q2.X;
-    c.y02 = q2.Y;
-    c.z02 = q2.Z;
-    c.px02 = q2.Px;
-    c.py02 = q2.Py;
-    c.pz02 = q2.Pz;
-    c.pt22 = c.px02 * c.px02 + c.py02 * c.py02;
+    c.bq1 = h1.bq;
+    c.bq2 = h2.bq;
+
+    c.x01 = h1.state.x;
+    c.y01 = h1.state.y;
+    c.z01 = h1.state.z;
+    c.px01 = h1.state.px;
+    c.py01 = h1.state.py;
+    c.pz01 = h1.state.pz;
+    c.pt12 = h1.pt2;
+
+    c.x02 = h2.state.x;
+    c.y02 = h2.state.y;
+    c.z02 = h2.state.z;
+    c.px02 = h2.state.px;
+    c.py02 = h2.state.py;
+    c.pz02 = h2.state.pz;
+    c.pt22 = h2.pt2;
 
     c.dx0 = c.x01 - c.x02;
     c.dy0 = c.y01 - c.y02;
@@ -125,14 +130,14 @@ std::pair<Seed, Seed> FastPCAs_XY(const POD::Track& q1, const POD::Track& q2, do
         }
     }
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "seed1_xy.ds = {:13.6e}", seed1_xy.ds);
-    Logger::Debug(__FUNCTION__, "seed1_xy.(x,y,z) = {}", seed1_xy.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed1_xy.(px,py,pz) = {}", seed1_xy.pca.mom);
-    Logger::Debug(__FUNCTION__, "seed2_xy.ds = {:13.6e}", seed2_xy.ds);
-    Logger::Debug(__FUNCTION__, "seed2_xy.(x,y,z) = {}", seed2_xy.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed2_xy.(px,py,pz) = {}", seed2_xy.pca.mom);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "seed1_xy.ds = {:13.6e}", seed1_xy.ds);
+        Logger::Debug(__FUNCTION__, "seed1_xy.(x,y,z) = {}", seed1_xy.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed1_xy.(px,py,pz) = {}", seed1_xy.pca.mom);
+        Logger::Debug(__FUNCTION__, "seed2_xy.ds = {:13.6e}", seed2_xy.ds);
+        Logger::Debug(__FUNCTION__, "seed2_xy.(x,y,z) = {}", seed2_xy.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed2_xy.(px,py,pz) = {}", seed2_xy.pca.mom);
+    }
 
     return {seed1_xy, seed2_xy};
 }
@@ -198,14 +203,14 @@ std::pair<Seed, Seed> CorrectPCAs_Z(const Seed& s1_xy, const Seed& s2_xy, Cache&
 
     c.pca_dz_worked = 1;
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "seed1.ds = {:13.6e}", s1.ds);
-    Logger::Debug(__FUNCTION__, "seed1.(x,y,z) = {}", s1.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed1.(px,py,pz) = {}", s1.pca.mom);
-    Logger::Debug(__FUNCTION__, "seed2.ds = {:13.6e}", s2.ds);
-    Logger::Debug(__FUNCTION__, "seed2.(x,y,z) = {}", s2.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed2.(px,py,pz) = {}", s2.pca.mom);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "seed1.ds = {:13.6e}", s1.ds);
+        Logger::Debug(__FUNCTION__, "seed1.(x,y,z) = {}", s1.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed1.(px,py,pz) = {}", s1.pca.mom);
+        Logger::Debug(__FUNCTION__, "seed2.ds = {:13.6e}", s2.ds);
+        Logger::Debug(__FUNCTION__, "seed2.(x,y,z) = {}", s2.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed2.(px,py,pz) = {}", s2.pca.mom);
+    }
 
     return {s1, s2};
 }
@@ -296,23 +301,23 @@ std::pair<Deriv, Deriv> ComputeDerivatives_XY(Cache& c) {
         dd1dr2[4] += c.py02 * c.pt12 / c.d1;
     }
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "dk11dr2 = {}", dk11dr2);
-    Logger::Debug(__FUNCTION__, "dk12dr1 = {}", dk12dr1);
-    Logger::Debug(__FUNCTION__, "dk12dr2 = {}", dk12dr2);
-    Logger::Debug(__FUNCTION__, "dk21dr1 = {}", dk21dr1);
-    Logger::Debug(__FUNCTION__, "dk21dr2 = {}", dk21dr2);
-    Logger::Debug(__FUNCTION__, "dk22dr1 = {}", dk22dr1);
-    Logger::Debug(__FUNCTION__, "dk22dr2 = {}", dk22dr2);
-    Logger::Debug(__FUNCTION__, "dkddr1 = {}", dkddr1);
-    Logger::Debug(__FUNCTION__, "dkddr2 = {}", dkddr2);
-    Logger::Debug(__FUNCTION__, "dc1dr1 = {}", dc1dr1);
-    Logger::Debug(__FUNCTION__, "dc1dr2 = {}", dc1dr2);
-    Logger::Debug(__FUNCTION__, "dc2dr1 = {}", dc2dr1);
-    Logger::Debug(__FUNCTION__, "dc2dr2 = {}", dc2dr2);
-    Logger::Debug(__FUNCTION__, "dd1dr1 = {}", dd1dr1);
-    Logger::Debug(__FUNCTION__, "dd1dr2 = {}", dd1dr2);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "dk11dr2 = {}", dk11dr2);
+        Logger::Debug(__FUNCTION__, "dk12dr1 = {}", dk12dr1);
+        Logger::Debug(__FUNCTION__, "dk12dr2 = {}", dk12dr2);
+        Logger::Debug(__FUNCTION__, "dk21dr1 = {}", dk21dr1);
+        Logger::Debug(__FUNCTION__, "dk21dr2 = {}", dk21dr2);
+        Logger::Debug(__FUNCTION__, "dk22dr1 = {}", dk22dr1);
+        Logger::Debug(__FUNCTION__, "dk22dr2 = {}", dk22dr2);
+        Logger::Debug(__FUNCTION__, "dkddr1 = {}", dkddr1);
+        Logger::Debug(__FUNCTION__, "dkddr2 = {}", dkddr2);
+        Logger::Debug(__FUNCTION__, "dc1dr1 = {}", dc1dr1);
+        Logger::Debug(__FUNCTION__, "dc1dr2 = {}", dc1dr2);
+        Logger::Debug(__FUNCTION__, "dc2dr1 = {}", dc2dr1);
+        Logger::Debug(__FUNCTION__, "dc2dr2 = {}", dc2dr2);
+        Logger::Debug(__FUNCTION__, "dd1dr1 = {}", dd1dr1);
+        Logger::Debug(__FUNCTION__, "dd1dr2 = {}", dd1dr2);
+    }
 
     // particle 1 //
 
@@ -321,12 +326,12 @@ std::pair<Deriv, Deriv> ComputeDerivatives_XY(Cache& c) {
     c.cc1 = c.bb1 * c.bb1 + c.aa1 * c.aa1;
     c.dd1 = c.cc1 > 0. ? (1. / c.bq1 * 1. / c.cc1) : 0.;
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "(end) c.aa1 = {:13.6e}", c.aa1);
-    Logger::Debug(__FUNCTION__, "(end) c.bb1 = {:13.6e}", c.bb1);
-    Logger::Debug(__FUNCTION__, "(end) c.cc1 = {:13.6e}", c.cc1);
-    Logger::Debug(__FUNCTION__, "(end) c.dd1 = {:13.6e}", c.dd1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "(end) c.aa1 = {:13.6e}", c.aa1);
+        Logger::Debug(__FUNCTION__, "(end) c.bb1 = {:13.6e}", c.bb1);
+        Logger::Debug(__FUNCTION__, "(end) c.cc1 = {:13.6e}", c.cc1);
+        Logger::Debug(__FUNCTION__, "(end) c.dd1 = {:13.6e}", c.dd1);
+    }
 
     for (std::size_t i = 0; i < 6; ++i) {
         double daa1_dr1 = c.bq1 * (dk11dr1[i] * c.c1 + c.k11 * dc1dr1[i] + c.w_sign * dk21dr1[i] * c.d1 + c.w_sign * c.k21 * dd1dr1[i]);
@@ -345,12 +350,12 @@ std::pair<Deriv, Deriv> ComputeDerivatives_XY(Cache& c) {
     c.cc2 = c.bb2 * c.bb2 + c.aa2 * c.aa2;
     c.dd2 = c.cc2 > 0. ? (1. / c.bq2 * 1. / c.cc2) : 0.;
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "(end) c.aa2 = {:13.6e}", c.aa2);
-    Logger::Debug(__FUNCTION__, "(end) c.bb2 = {:13.6e}", c.bb2);
-    Logger::Debug(__FUNCTION__, "(end) c.cc2 = {:13.6e}", c.cc2);
-    Logger::Debug(__FUNCTION__, "(end) c.dd2 = {:13.6e}", c.dd2);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "(end) c.aa2 = {:13.6e}", c.aa2);
+        Logger::Debug(__FUNCTION__, "(end) c.bb2 = {:13.6e}", c.bb2);
+        Logger::Debug(__FUNCTION__, "(end) c.cc2 = {:13.6e}", c.cc2);
+        Logger::Debug(__FUNCTION__, "(end) c.dd2 = {:13.6e}", c.dd2);
+    }
 
     for (std::size_t i = 0; i < 6; ++i) {
         double daa2_dr1 = c.bq2 * (dk12dr1[i] * c.c2 + c.k12 * dc2dr1[i] + c.w_sign * dk22dr1[i] * c.d1 + c.w_sign * c.k22 * dd1dr1[i]);
@@ -362,12 +367,12 @@ std::pair<Deriv, Deriv> ComputeDerivatives_XY(Cache& c) {
         deriv2.ds_dr[i] = c.dd2 * (daa2_dr2 * c.bb2 - dbb2_dr2 * c.aa2);
     }
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "(end) deriv1.ds_dr = {}", deriv1.ds_dr);
-    Logger::Debug(__FUNCTION__, "(end) deriv1.ds_dr1 = {}", deriv1.ds_dr1);
-    Logger::Debug(__FUNCTION__, "(end) deriv2.ds_dr = {}", deriv2.ds_dr);
-    Logger::Debug(__FUNCTION__, "(end) deriv2.ds_dr1 = {}", deriv2.ds_dr1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "(end) deriv1.ds_dr = {}", deriv1.ds_dr);
+        Logger::Debug(__FUNCTION__, "(end) deriv1.ds_dr1 = {}", deriv1.ds_dr1);
+        Logger::Debug(__FUNCTION__, "(end) deriv2.ds_dr = {}", deriv2.ds_dr);
+        Logger::Debug(__FUNCTION__, "(end) deriv2.ds_dr1 = {}", deriv2.ds_dr1);
+    }
 
     return {deriv1, deriv2};
 }
@@ -388,18 +393,18 @@ std::pair<Deriv, Deriv> UpdateDerivatives_Z(const Seed& s1_xy, const Seed& s2_xy
 
     if (c.pca_dz_worked == 0) return {d1_xy, d2_xy};
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "s1_xy.sin = {}", s1_xy.sin);
-    Logger::Debug(__FUNCTION__, "s1_xy.cos = {}", s1_xy.cos);
-    Logger::Debug(__FUNCTION__, "s1_xy.sB  = {}", s1_xy.sB);
-    Logger::Debug(__FUNCTION__, "s1_xy.cB  = {}", s1_xy.cB);
-    Logger::Debug(__FUNCTION__, "s1_xy.ds  = {}", s1_xy.ds);
-    Logger::Debug(__FUNCTION__, "s2_xy.sin = {}", s2_xy.sin);
-    Logger::Debug(__FUNCTION__, "s2_xy.cos = {}", s2_xy.cos);
-    Logger::Debug(__FUNCTION__, "s2_xy.sB  = {}", s2_xy.sB);
-    Logger::Debug(__FUNCTION__, "s2_xy.cB  = {}", s2_xy.cB);
-    Logger::Debug(__FUNCTION__, "s2_xy.ds  = {}", s2_xy.ds);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "s1_xy.sin = {}", s1_xy.sin);
+        Logger::Debug(__FUNCTION__, "s1_xy.cos = {}", s1_xy.cos);
+        Logger::Debug(__FUNCTION__, "s1_xy.sB  = {}", s1_xy.sB);
+        Logger::Debug(__FUNCTION__, "s1_xy.cB  = {}", s1_xy.cB);
+        Logger::Debug(__FUNCTION__, "s1_xy.ds  = {}", s1_xy.ds);
+        Logger::Debug(__FUNCTION__, "s2_xy.sin = {}", s2_xy.sin);
+        Logger::Debug(__FUNCTION__, "s2_xy.cos = {}", s2_xy.cos);
+        Logger::Debug(__FUNCTION__, "s2_xy.sB  = {}", s2_xy.sB);
+        Logger::Debug(__FUNCTION__, "s2_xy.cB  = {}", s2_xy.cB);
+        Logger::Debug(__FUNCTION__, "s2_xy.ds  = {}", s2_xy.ds);
+    }
 
     // update derivatives //
 
@@ -422,20 +427,20 @@ std::pair<Deriv, Deriv> UpdateDerivatives_Z(const Seed& s1_xy, const Seed& s2_xy
     double dsl2ds0 = a2_ds0 / c.detp - c.a2 * detp_ds0 / detp2;
     double dsl2ds1 = a2_ds1 / c.detp - c.a2 * detp_ds1 / detp2;
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "lp1p2_ds0 = {:13.6e}", lp1p2_ds0);
-    Logger::Debug(__FUNCTION__, "lp1p2_ds1 = {:13.6e}", lp1p2_ds1);
-    Logger::Debug(__FUNCTION__, "ldrp1_ds0 = {:13.6e}", ldrp1_ds0);
-    Logger::Debug(__FUNCTION__, "ldrp1_ds1 = {:13.6e}", ldrp1_ds1);
-    Logger::Debug(__FUNCTION__, "ldrp2_ds0 = {:13.6e}", ldrp2_ds0);
-    Logger::Debug(__FUNCTION__, "ldrp2_ds1 = {:13.6e}", ldrp2_ds1);
-    Logger::Debug(__FUNCTION__, "detp_ds0  = {:13.6e}", detp_ds0);
-    Logger::Debug(__FUNCTION__, "detp_ds1  = {:13.6e}", detp_ds1);
-    Logger::Debug(__FUNCTION__, "a1_ds0    = {:13.6e}", a1_ds0);
-    Logger::Debug(__FUNCTION__, "a1_ds1    = {:13.6e}", a1_ds1);
-    Logger::Debug(__FUNCTION__, "a2_ds0    = {:13.6e}", a2_ds0);
-    Logger::Debug(__FUNCTION__, "a2_ds1    = {:13.6e}", a2_ds1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "lp1p2_ds0 = {:13.6e}", lp1p2_ds0);
+        Logger::Debug(__FUNCTION__, "lp1p2_ds1 = {:13.6e}", lp1p2_ds1);
+        Logger::Debug(__FUNCTION__, "ldrp1_ds0 = {:13.6e}", ldrp1_ds0);
+        Logger::Debug(__FUNCTION__, "ldrp1_ds1 = {:13.6e}", ldrp1_ds1);
+        Logger::Debug(__FUNCTION__, "ldrp2_ds0 = {:13.6e}", ldrp2_ds0);
+        Logger::Debug(__FUNCTION__, "ldrp2_ds1 = {:13.6e}", ldrp2_ds1);
+        Logger::Debug(__FUNCTION__, "detp_ds0  = {:13.6e}", detp_ds0);
+        Logger::Debug(__FUNCTION__, "detp_ds1  = {:13.6e}", detp_ds1);
+        Logger::Debug(__FUNCTION__, "a1_ds0    = {:13.6e}", a1_ds0);
+        Logger::Debug(__FUNCTION__, "a1_ds1    = {:13.6e}", a1_ds1);
+        Logger::Debug(__FUNCTION__, "a2_ds0    = {:13.6e}", a2_ds0);
+        Logger::Debug(__FUNCTION__, "a2_ds1    = {:13.6e}", a2_ds1);
+    }
 
     std::array<double, 6> dsldr0{};
     std::array<double, 6> dsldr1{};
@@ -459,12 +464,12 @@ std::pair<Deriv, Deriv> UpdateDerivatives_Z(const Seed& s1_xy, const Seed& s2_xy
         d2.ds_dr[i] += dsldr3[i];
     }
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "(intermediate) deriv1.ds_dr  = {}", d1.ds_dr);
-    Logger::Debug(__FUNCTION__, "(intermediate) deriv1.ds_dr1 = {}", d1.ds_dr1);
-    Logger::Debug(__FUNCTION__, "(intermediate) deriv2.ds_dr  = {}", d2.ds_dr);
-    Logger::Debug(__FUNCTION__, "(intermediate) deriv2.ds_dr1 = {}", d2.ds_dr1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "(intermediate) deriv1.ds_dr  = {}", d1.ds_dr);
+        Logger::Debug(__FUNCTION__, "(intermediate) deriv1.ds_dr1 = {}", d1.ds_dr1);
+        Logger::Debug(__FUNCTION__, "(intermediate) deriv2.ds_dr  = {}", d2.ds_dr);
+        Logger::Debug(__FUNCTION__, "(intermediate) deriv2.ds_dr1 = {}", d2.ds_dr1);
+    }
 
     std::array<double, 6> lp1p2_dr0{0.,
                                     0.,
@@ -505,16 +510,16 @@ std::pair<Deriv, Deriv> UpdateDerivatives_Z(const Seed& s1_xy, const Seed& s2_xy
     std::array<double, 6> p12_dr0{0., 0., 0., 2. * c.px01, 2. * c.py01, 2. * c.pz01};
     std::array<double, 6> p22_dr1{0., 0., 0., 2. * c.px02, 2. * c.py02, 2. * c.pz02};
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "lp1p2_dr0 = {}", lp1p2_dr0);
-    Logger::Debug(__FUNCTION__, "lp1p2_dr1 = {}", lp1p2_dr1);
-    Logger::Debug(__FUNCTION__, "ldrp1_dr0 = {}", ldrp1_dr0);
-    Logger::Debug(__FUNCTION__, "ldrp1_dr1 = {}", ldrp1_dr1);
-    Logger::Debug(__FUNCTION__, "ldrp2_dr0 = {}", ldrp2_dr0);
-    Logger::Debug(__FUNCTION__, "ldrp2_dr1 = {}", ldrp2_dr1);
-    Logger::Debug(__FUNCTION__, "p12_dr0 = {}", p12_dr0);
-    Logger::Debug(__FUNCTION__, "p22_dr1 = {}", p22_dr1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "lp1p2_dr0 = {}", lp1p2_dr0);
+        Logger::Debug(__FUNCTION__, "lp1p2_dr1 = {}", lp1p2_dr1);
+        Logger::Debug(__FUNCTION__, "ldrp1_dr0 = {}", ldrp1_dr0);
+        Logger::Debug(__FUNCTION__, "ldrp1_dr1 = {}", ldrp1_dr1);
+        Logger::Debug(__FUNCTION__, "ldrp2_dr0 = {}", ldrp2_dr0);
+        Logger::Debug(__FUNCTION__, "ldrp2_dr1 = {}", ldrp2_dr1);
+        Logger::Debug(__FUNCTION__, "p12_dr0 = {}", p12_dr0);
+        Logger::Debug(__FUNCTION__, "p22_dr1 = {}", p22_dr1);
+    }
 
     for (std::size_t i = 0; i < 6; ++i) {
         double a1_dr0 = ldrp2_dr0[i] * c.lp1p2 + c.ldrp2 * lp1p2_dr0[i] - ldrp1_dr0[i] * c.p22;
@@ -530,14 +535,273 @@ std::pair<Deriv, Deriv> UpdateDerivatives_Z(const Seed& s1_xy, const Seed& s2_xy
         d2.ds_dr[i] += a2_dr1 / c.detp - c.a2 * detp_dr1 / detp2;
     }
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "(end) deriv1.ds_dr  = {}", d1.ds_dr);
-    Logger::Debug(__FUNCTION__, "(end) deriv1.ds_dr1 = {}", d1.ds_dr1);
-    Logger::Debug(__FUNCTION__, "(end) deriv2.ds_dr  = {}", d2.ds_dr);
-    Logger::Debug(__FUNCTION__, "(end) deriv2.ds_dr1 = {}", d2.ds_dr1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "(end) deriv1.ds_dr  = {}", d1.ds_dr);
+        Logger::Debug(__FUNCTION__, "(end) deriv1.ds_dr1 = {}", d1.ds_dr1);
+        Logger::Debug(__FUNCTION__, "(end) deriv2.ds_dr  = {}", d2.ds_dr);
+        Logger::Debug(__FUNCTION__, "(end) deriv2.ds_dr1 = {}", d2.ds_dr1);
+    }
 
     return {d1, d2};
 }
 
+// # Batched Methods # //
+
+namespace {
+
+// Squared sine of the angles below which a pair is left to the one-pair path, see the end of `SeedPairs(...)`: in float,
+// as past it the DCA was found off by more than `kBatchMargin_Float`; in double, as past it the angles keep less than
+// half of their digits, though the DCA was found off by far less than `kBatchMargin`, see `checks/SeedingMargins.cxx`.
+template <typename T>
+constexpr T kIllConditioned = std::is_same_v<T, float> ? T(1E-2) : T(1E-8);  // HARDCODED
+
+// Helix columns of one track per lane, gathered from a track store -- and rounded to the precision of the pack. Lanes
+// past `n` repeat the last track, so that every lane computes something finite, to be discarded.
+template <typename V>
+struct HelixPack {
+    V x, y, z;
+    V px, py, pz;
+    V pt2, bq;
+};
+
+template <typename V>
+HelixPack<V> Gather(const TrackStore& s, std::span<const TrackView::Row> rows, std::size_t first, std::size_t n) {
+    using T = typename V::Scalar;
+    std::array<std::array<T, V::kWidth>, 8> lanes{};
+    for (std::size_t lane = 0; lane < V::kWidth; ++lane) {
+        const std::size_t i = rows[first + std::min(lane, n - 1)];
+        lanes[0][lane] = static_cast<T>(s.x[i]);
+        lanes[1][lane] = static_cast<T>(s.y[i]);
+        lanes[2][lane] = static_cast<T>(s.z[i]);
+        lanes[3][lane] = static_cast<T>(s.px[i]);
+        lanes[4][lane] = static_cast<T>(s.py[i]);
+        lanes[5][lane] = static_cast<T>(s.pz[i]);
+        lanes[6][lane] = static_cast<T>(s.pt2[i]);
+        lanes[7][lane] = static_cast<T>(s.bq[i]);
+    }
+    return {V::Load(lanes[0].data()), V::Load(lanes[1].data()), V::Load(lanes[2].data()), V::Load(lanes[3].data()),
+            V::Load(lanes[4].data()), V::Load(lanes[5].data()), V::Load(lanes[6].data()), V::Load(lanes[7].data())};
+}
+
+// Point of a helix after rotating it by `theta`, i.e. at the end of the arc `ds = theta / bq`.
+template <typename V>
+struct PointPack {
+    V x, y, z;
+    V px, py;
+    V ds;
+};
+
+template <typename V>
+PointPack<V> Transport(const HelixPack<V>& h, V ds) {
+    V sin;
+    V cos;
+    Simd::SinCos(h.bq * ds, sin, cos);
+    const V sB = sin / h.bq;
+    const V cB = (V(1) - cos) / h.bq;
+    return {.x = h.x + sB * h.px + cB * h.py,
+            .y = h.y - cB * h.px + sB * h.py,
+            .z = h.z + ds * h.pz,
+            .px = cos * h.px + sin * h.py,
+            .py = -sin * h.px + cos * h.py,
+            .ds = ds};
+}
+
+template <typename V>
+PointPack<V> TransportByAngle(const HelixPack<V>& h, V theta) {
+    V sin;
+    V cos;
+    Simd::SinCos(theta, sin, cos);
+    const V sB = sin / h.bq;
+    const V cB = (V(1) - cos) / h.bq;
+    const V ds = theta / h.bq;
+    return {.x = h.x + sB * h.px + cB * h.py,
+            .y = h.y - cB * h.px + sB * h.py,
+            .z = h.z + ds * h.pz,
+            .px = cos * h.px + sin * h.py,
+            .py = -sin * h.px + cos * h.py,
+            .ds = ds};
+}
+
+template <typename V, typename M>
+PointPack<V> Select(M mask, const PointPack<V>& a, const PointPack<V>& b) {
+    return {Select(mask, a.x, b.x), Select(mask, a.y, b.y), Select(mask, a.z, b.z), Select(mask, a.px, b.px), Select(mask, a.py, b.py),
+            Select(mask, a.ds, b.ds)};
+}
+
+template <typename V>
+V Distance2(const PointPack<V>& p1, const PointPack<V>& p2) {
+    const V dx = p2.x - p1.x;
+    const V dy = p2.y - p1.y;
+    const V dz = p2.z - p1.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Squared DCA of a pack of pairs, and the PCAs it's measured between.
+template <typename V>
+struct SeedPack {
+    V dca2;
+    PointPack<V> pca1, pca2;
+};
+
+// `FastPCAs_XY` followed by `CorrectPCAs_Z`, the same operations on every lane, keeping only the PCAs and their squared
+// distance.
+template <typename V>
+SeedPack<V> SeedPairs(const HelixPack<V>& h1, const HelixPack<V>& h2) {
+    using T = typename V::Scalar;
+
+    // -- pairwise terms, as in `FastPCAs_XY`
+    const V dx0 = h1.x - h2.x;
+    const V dy0 = h1.y - h2.y;
+    const V dr02 = dx0 * dx0 + dy0 * dy0;
+    const V drp1 = dx0 * h1.px + dy0 * h1.py;
+    const V dxyp1 = dx0 * h1.py - dy0 * h1.px;
+    const V drp2 = dx0 * h2.px + dy0 * h2.py;
+    const V dxyp2 = dx0 * h2.py - dy0 * h2.px;
+    const V p1p2 = h1.px * h2.px + h1.py * h2.py;
+    const V dp1p2 = h1.px * h2.py - h2.px * h1.py;
+
+    const V k11 = h2.bq * drp1 - dp1p2;
+    const V k21 = h1.bq * (h2.bq * dxyp1 - p1p2) + h2.bq * h1.pt2;
+    const V k12 = h1.bq * drp2 - dp1p2;
+    const V k22 = h2.bq * (h1.bq * dxyp2 + p1p2) - h1.bq * h2.pt2;
+
+    const V kp = dxyp1 * h2.bq - dxyp2 * h1.bq - p1p2;
+    const V kd = dr02 * h1.bq * h2.bq / V(2) + kp;
+    const V c1 = -h1.bq * kd - h1.pt2 * h2.bq;
+    const V c2 = h2.bq * kd + h2.pt2 * h1.bq;
+    const V d1 = Sqrt(Max(h1.pt2 * h2.pt2 - kd * kd, V(0)));
+
+    // -- both sign branches, keeping the closest one, `+1` on ties
+    PointPack<V> best1{};
+    PointPack<V> best2{};
+    V best_dca2 = std::numeric_limits<T>::max();
+    for (const T sign : {T(+1), T(-1)}) {
+        const V theta1 = Simd::Atan2(h1.bq * (k11 * c1 + sign * k21 * d1), sign * h1.bq * k11 * d1 * h1.bq - k21 * c1);
+        const V theta2 = Simd::Atan2(h2.bq * (k12 * c2 + sign * k22 * d1), sign * h2.bq * k12 * d1 * h2.bq - k22 * c2);
+        const PointPack<V> p1 = TransportByAngle(h1, theta1);
+        const PointPack<V> p2 = TransportByAngle(h2, theta2);
+        const V dca2 = Distance2(p1, p2);
+
+        const auto closer = dca2 < best_dca2;
+        best1 = Select(closer, p1, best1);
+        best2 = Select(closer, p2, best2);
+        best_dca2 = Select(closer, dca2, best_dca2);
+    }
+
+    // -- z correction, as in `CorrectPCAs_Z`
+    const V dx = best2.x - best1.x;
+    const V dy = best2.y - best1.y;
+    const V dz = best2.z - best1.z;
+    const V p12 = best1.px * best1.px + best1.py * best1.py + h1.pz * h1.pz;
+    const V p22 = best2.px * best2.px + best2.py * best2.py + h2.pz * h2.pz;
+    const V lp1p2 = best1.px * best2.px + best1.py * best2.py + h1.pz * h2.pz;
+    const V detp = lp1p2 * lp1p2 - p12 * p22;
+    const V ldrp1 = best1.px * dx + best1.py * dy + h1.pz * dz;
+    const V ldrp2 = best2.px * dx + best2.py * dy + h2.pz * dz;
+    const V a1 = ldrp2 * lp1p2 - ldrp1 * p22;
+    const V a2 = ldrp2 * p12 - ldrp1 * lp1p2;
+    const PointPack<V> corrected1 = Transport(h1, best1.ds + a1 / detp);
+    const PointPack<V> corrected2 = Transport(h2, best2.ds + a2 / detp);
+
+    // -- protection of `CorrectPCAs_Z`, which keeps the seeds of the first phase
+    const auto keep_xy = Abs(detp) < V(static_cast<T>(Common::AbsAlmostZero));
+    const PointPack<V> pca1 = Select(keep_xy, best1, corrected1);
+    const PointPack<V> pca2 = Select(keep_xy, best2, corrected2);
+    V dca2 = Distance2(pca1, pca2);
+    // -- neither branch was finite, leave the decision to the one-pair path
+    dca2 = Select(best_dca2 < V(std::numeric_limits<T>::max()), dca2, V(std::numeric_limits<T>::quiet_NaN()));
+
+    // -- nearly tangent, or coinciding, circles, where both branches meet, and nearly parallel momenta at the PCAs, where
+    //    `detp` vanishes: the angles, or the correction along z, keep only half of their digits, hence these pairs are
+    //    left to the one-pair path
+    const V sin2_crossing = V(1) - kd * kd / (h1.pt2 * h2.pt2);
+    const V sin2_momenta = -detp / (p12 * p22);
+    const auto ill_conditioned = Select(Abs(sin2_crossing) < V(kIllConditioned<T>), V(0), sin2_momenta) < V(kIllConditioned<T>);
+    dca2 = Select(ill_conditioned, V(std::numeric_limits<T>::quiet_NaN()), dca2);
+    return {.dca2 = dca2, .pca1 = pca1, .pca2 = pca2};
+}
+
+template <typename T>
+void SeedDCA2(const TrackStore& s1, std::span<const TrackView::Row> rows1, const TrackStore& s2, std::span<const TrackView::Row> rows2,
+              std::span<T> dca2) {
+    using V = Simd::Pack<T>;
+    std::array<T, V::kWidth> lanes{};
+    for (std::size_t first = 0; first < rows1.size(); first += V::kWidth) {
+        const std::size_t n = std::min(V::kWidth, rows1.size() - first);
+        SeedPairs(Gather<V>(s1, rows1, first, n), Gather<V>(s2, rows2, first, n)).dca2.Store(lanes.data());
+        std::copy_n(lanes.begin(), n, dca2.begin() + static_cast<std::ptrdiff_t>(first));
+    }
+}
+
+template <typename T>
+std::size_t CompactSurvivors(std::span<const T> dca2, double max_dca, double margin, std::span<std::uint32_t> survivors) {
+    const auto max_dca2 = static_cast<T>(max_dca * max_dca * (1. + margin) * (1. + margin));
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < dca2.size(); ++i) {
+        // -- branchless, written always and kept only if it survives; NaN survives, as it does in `PostSeedCuts`
+        survivors[n] = static_cast<std::uint32_t>(i);
+        n += static_cast<std::size_t>(!(dca2[i] > max_dca2));
+    }
+    return n;
+}
+
+}  // namespace
+
+// First phase of seeding a block of pairs, the `i`-th one made of tracks `rows1[i]` of `s1` and `rows2[i]` of `s2`:
+// the squared DCA between the seeds `FastCorrectPCAs` would find, lane by lane, without building any seed nor cache.
+// Arguments:
+// - `s1`, `rows1` -- [input] first track of every pair
+// - `s2`, `rows2` -- [input] second track of every pair, as many as `rows1`
+// - `dca2`        -- [output] squared DCA of every pair, as many as `rows1`; NaN if the seeds aren't defined, or
+//                    too ill-conditioned to bound the error of the DCA, see `kIllConditioned`
+// NOTE: only meant to reject pairs, see `CompactSurvivors(...)`, the seeds of the survivors must be found one by one
+void SeedDCA2(const TrackStore& s1, std::span<const TrackView::Row> rows1, const TrackStore& s2, std::span<const TrackView::Row> rows2,
+              std::span<double> dca2) {
+    SeedDCA2<double>(s1, rows1, s2, rows2, dca2);
+}
+
+// Same, in float, twice as many pairs at once, with a looser bound on the conditioning, see `kIllConditioned`.
+// NOTE: only meant to reject pairs before `SeedDCA2(...)` in double, which must confirm the survivors
+void SeedDCA2(const TrackStore& s1, std::span<const TrackView::Row> rows1, const TrackStore& s2, std::span<const TrackView::Row> rows2,
+              std::span<float> dca2) {
+    SeedDCA2<float>(s1, rows1, s2, rows2, dca2);
+}
+
+// Same first phase, in double, keeping the PCAs of every pair instead of their DCA -- the positions `FastCorrectPCAs`
+// would find, lane by lane.
+// NOTE: only meant to check the batch against the one-pair path, see `--cross-check`
+void SeedPCAs(const TrackStore& s1, std::span<const TrackView::Row> rows1, const TrackStore& s2, std::span<const TrackView::Row> rows2,
+              std::span<std::array<double, 3>> pca1, std::span<std::array<double, 3>> pca2) {
+    using V = Simd::VecD;
+    std::array<std::array<double, V::kWidth>, 6> lanes{};
+    for (std::size_t first = 0; first < rows1.size(); first += V::kWidth) {
+        const std::size_t n = std::min(V::kWidth, rows1.size() - first);
+        const SeedPack<V> seeds = SeedPairs(Gather<V>(s1, rows1, first, n), Gather<V>(s2, rows2, first, n));
+        seeds.pca1.x.Store(lanes[0].data());
+        seeds.pca1.y.Store(lanes[1].data());
+        seeds.pca1.z.Store(lanes[2].data());
+        seeds.pca2.x.Store(lanes[3].data());
+        seeds.pca2.y.Store(lanes[4].data());
+        seeds.pca2.z.Store(lanes[5].data());
+        for (std::size_t lane = 0; lane < n; ++lane) {
+            pca1[first + lane] = {lanes[0][lane], lanes[1][lane], lanes[2][lane]};
+            pca2[first + lane] = {lanes[3][lane], lanes[4][lane], lanes[5][lane]};
+        }
+    }
+}
+
+// Second phase. Keep the pairs of a block that may pass a DCA cut, within the margin of the precision of `dca2`.
+// Arguments:
+// - `dca2`      -- [input] squared DCA of every pair, from `SeedDCA2(...)`
+// - `max_dca`   -- [input] cut on the DCA
+// - `survivors` -- [output] positions of the surviving pairs within the block, in order; as large as `dca2`
+// Return: number of survivors
+std::size_t CompactSurvivors(std::span<const double> dca2, double max_dca, std::span<std::uint32_t> survivors) {
+    return CompactSurvivors<double>(dca2, max_dca, kBatchMargin, survivors);
+}
+
+std::size_t CompactSurvivors(std::span<const float> dca2, double max_dca, std::span<std::uint32_t> survivors) {
+    return CompactSurvivors<float>(dca2, max_dca, kBatchMargin_Float, survivors);
+}
+
 }  // namespace T2DS::Seeder::HelixHelix
@@ -4,13 +4,11 @@
 
 #include "common/Constants.hpp"
 #include "common/Math.hpp"
-#include "common/POD_Track.hpp"
 #include "common/POD_V0.hpp"
 
 #include "Seeder/BaseSeeder.hxx"
-#if T2DS_DEBUG
+#include "Seeder/TrackStore.hxx"
 #include "App/Logger.hxx"
-#endif
 
 #include "Seeder/SeederHelixLine.hxx"
 
@@ -20,30 +18,30 @@ namespace T2DS::Seeder::HelixLine {
 // One particle is charged under a constant magnetic field and the other one is neutral.
 // Transport the former as a helix and the latter as a line.
 // Arguments:
-// - `q1`    -- [input] charged particle, transports as helix
+// - `h1`    -- [input] helix of charged particle
 // - `n2`    -- [input] neutral particle, transports as straight line
-// - `bz`    -- [input] z-component of homogeneous magnetic field
 // - `cache` -- [output,optional] useful struct to store intermediate results for next phases
 // Return: (packed as a pair of `Seed` structs)
 // - `ds`  -- transport parameters
 // - `pca` -- points of closest approach (position and momentum)
 // - `theta`, `sin`, `cos`, `sB`, `cB` -- cached ds computation variables
-std::pair<Seed, Seed> FastPCAs_XY(const POD::Track& q1, const POD::V0& n2, double bz, Cache* cache) {
+// NOTE: single-track terms come precomputed in `HelixParams`, only the pairwise ones are computed here
+std::pair<Seed, Seed> FastPCAs_XY(const HelixParams& h1, const POD::V0& n2, Cache* cache) {
 
     // cache //
 
     Cache local;
     Cache& c = cache != nullptr ? *cache : local;
 
-    c.bq1 = bz * static_cast<double>(q1.Charge) * Common::Kappa;
+    c.bq1 = h1.bq;
 
-    c.x01 = static_cast<double>(q1.X);
-    c.y01 = static_cast<double>(q1.Y);
-    c.z01 = static_cast<double>(q1.Z);
-    c.px01 = static_cast<double>(q1.Px);
-    c.py01 = static_cast<double>(q1.Py);
-    c.pz01 = static_cast<double>(q1.Pz);
-    c.pt12 = c.px01 * c.px01 + c.py01 * c.py01;
+    c.x01 = h1.state.x;
+    c.y01 = h1.state.y;
+    c.z01 = h1.state.z;
+    c.px01 = h1.state.px;
+    c.py01 = h1.state.py;
+    c.pz01 = h1.state.pz;
+    c.pt12 = h1.pt2;
 
     c.x02 = static_cast<double>(n2.Decay_X);
     c.y02 = static_cast<double>(n2.Decay_Y);
@@ -131,14 +129,14 @@ std::pair<Seed, Seed> FastPCAs_XY(const POD::Track& q1, const POD::V0& n2, doubl
         }
     }
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "seed1_xy.ds = {:13.6e}", seed1_xy.ds);
-    Logger::Debug(__FUNCTION__, "seed1_xy.(x,y,z) = {}", seed1_xy.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed1_xy.(px,py,pz) = {}", seed1_xy.pca.mom);
-    Logger::Debug(__FUNCTION__, "seed2_xy.ds = {:13.6e}", seed2_xy.ds);
-    Logger::Debug(__FUNCTION__, "seed2_xy.(x,y,z) = {}", seed2_xy.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed2_xy.(px,py,pz) = {}", seed2_xy.pca.mom);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "seed1_xy.ds = {:13.6e}", seed1_xy.ds);
+        Logger::Debug(__FUNCTION__, "seed1_xy.(x,y,z) = {}", seed1_xy.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed1_xy.(px,py,pz) = {}", seed1_xy.pca.mom);
+        Logger::Debug(__FUNCTION__, "seed2_xy.ds = {:13.6e}", seed2_xy.ds);
+        Logger::Debug(__FUNCTION__, "seed2_xy.(x,y,z) = {}", seed2_xy.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed2_xy.(px,py,pz) = {}", seed2_xy.pca.mom);
+    }
 
     return {seed1_xy, seed2_xy};
 }
@@ -203,14 +201,14 @@ std::pair<Seed, Seed> CorrectPCAs_Z(const Seed& s1_xy, const Seed& s2_xy, Cache&
 
     c.pca_dz_worked = 1;
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "seed1.ds = {:13.6e}", s1.ds);
-    Logger::Debug(__FUNCTION__, "seed1.(x,y,z) = {}", s1.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed1.(px,py,pz) = {}", s1.pca.mom);
-    Logger::Debug(__FUNCTION__, "seed2.ds = {:13.6e}", s2.ds);
-    Logger::Debug(__FUNCTION__, "seed2.(x,y,z) = {}", s2.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed2.(px,py,pz) = {}", s2.pca.mom);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "seed1.ds = {:13.6e}", s1.ds);
+        Logger::Debug(__FUNCTION__, "seed1.(x,y,z) = {}", s1.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed1.(px,py,pz) = {}", s1.pca.mom);
+        Logger::Debug(__FUNCTION__, "seed2.ds = {:13.6e}", s2.ds);
+        Logger::Debug(__FUNCTION__, "seed2.(x,y,z) = {}", s2.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed2.(px,py,pz) = {}", s2.pca.mom);
+    }
 
     return {s1, s2};
 }
@@ -294,12 +292,12 @@ std::pair<Deriv, Deriv> ComputeDerivatives_XY(Cache& c) {
         deriv2.ds_dr[i] = dna_dr2 / c.nb - dnb2_dr2 * c.na / c.nb2;
     }
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "deriv1.ds_dr = {}", deriv1.ds_dr);
-    Logger::Debug(__FUNCTION__, "deriv1.ds_dr1 = {}", deriv1.ds_dr1);
-    Logger::Debug(__FUNCTION__, "deriv2.ds_dr = {}", deriv2.ds_dr);
-    Logger::Debug(__FUNCTION__, "deriv2.ds_dr1 = {}", deriv2.ds_dr1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "deriv1.ds_dr = {}", deriv1.ds_dr);
+        Logger::Debug(__FUNCTION__, "deriv1.ds_dr1 = {}", deriv1.ds_dr1);
+        Logger::Debug(__FUNCTION__, "deriv2.ds_dr = {}", deriv2.ds_dr);
+        Logger::Debug(__FUNCTION__, "deriv2.ds_dr1 = {}", deriv2.ds_dr1);
+    }
 
     return {deriv1, deriv2};
 }
@@ -392,12 +390,12 @@ std::pair<Deriv, Deriv> UpdateDerivatives_Z(const Seed& s1_xy, const Seed& s2_xy
         d2.ds_dr[i] += a2_dr1 / c.detp - c.a2 * detp_dr1 / detp2;
     }
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "deriv1.ds_dr  = {}", d1.ds_dr);
-    Logger::Debug(__FUNCTION__, "deriv1.ds_dr1 = {}", d1.ds_dr1);
-    Logger::Debug(__FUNCTION__, "deriv2.ds_dr  = {}", d2.ds_dr);
-    Logger::Debug(__FUNCTION__, "deriv2.ds_dr1 = {}", d2.ds_dr1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "deriv1.ds_dr  = {}", d1.ds_dr);
+        Logger::Debug(__FUNCTION__, "deriv1.ds_dr1 = {}", d1.ds_dr1);
+        Logger::Debug(__FUNCTION__, "deriv2.ds_dr  = {}", d2.ds_dr);
+        Logger::Debug(__FUNCTION__, "deriv2.ds_dr1 = {}", d2.ds_dr1);
+    }
 
     return {d1, d2};
 }
@@ -5,9 +5,7 @@
 #include "common/Math.hpp"
 
 #include "Seeder/BaseSeeder.hxx"
-#if T2DS_DEBUG
 #include "App/Logger.hxx"
-#endif
 
 #include "Seeder/SeederHelixVertex.hxx"
 
@@ -64,11 +62,11 @@ Seed FastPCA_XY(double x0, double y0, double z0, double px, double py, double pz
     seed.pca.xyz = {c.x0 + seed.sB * c.px0 + seed.cB * c.py0, c.y0 - seed.cB * c.px0 + seed.sB * c.py0, c.z0 + seed.ds * c.pz0};
     seed.pca.mom = {seed.cos * c.px0 + seed.sin * c.py0, -seed.sin * c.px0 + seed.cos * c.py0, c.pz0};
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "seed.ds = {:13.6e}", seed.ds);
-    Logger::Debug(__FUNCTION__, "seed.(x,y,z) = {}", seed.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed.(px,py,pz) = {}", seed.pca.mom);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "seed.ds = {:13.6e}", seed.ds);
+        Logger::Debug(__FUNCTION__, "seed.(x,y,z) = {}", seed.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed.(px,py,pz) = {}", seed.pca.mom);
+    }
 
     return seed;
 }
@@ -110,11 +108,11 @@ Seed CorrectPCA_Z(const Seed& s_xy, Cache& c) {
 
     c.pca_dz_worked = 1;
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "seed.ds = {:13.6e}", out.ds);
-    Logger::Debug(__FUNCTION__, "seed.(x,y,z) = {}", out.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed.(px,py,pz) = {}", out.pca.mom);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "seed.ds = {:13.6e}", out.ds);
+        Logger::Debug(__FUNCTION__, "seed.(x,y,z) = {}", out.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed.(px,py,pz) = {}", out.pca.mom);
+    }
 
     return out;
 }
@@ -148,10 +146,10 @@ Deriv ComputeDerivatives_XY(Cache& c) {
 
     out.ds_dr1 = {-out.ds_dr[0], -out.ds_dr[1], -out.ds_dr[2], 0., 0., 0.};
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "(end) deriv.ds_dr = {}", out.ds_dr);
-    Logger::Debug(__FUNCTION__, "(end) deriv.ds_dr1 = {}", out.ds_dr1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "(end) deriv.ds_dr = {}", out.ds_dr);
+        Logger::Debug(__FUNCTION__, "(end) deriv.ds_dr1 = {}", out.ds_dr1);
+    }
 
     return out;
 }
@@ -187,10 +185,10 @@ Deriv UpdateDerivatives_Z(const Seed& s_xy, const Deriv& d_xy, const Cache& c) {
 
     out.ds_dr1 = {-out.ds_dr[0], -out.ds_dr[1], -out.ds_dr[2], 0., 0., 0.};
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "(end) deriv.ds_dr = {}", out.ds_dr);
-    Logger::Debug(__FUNCTION__, "(end) deriv.ds_dr1 = {}", out.ds_dr1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "(end) deriv.ds_dr = {}", out.ds_dr);
+        Logger::Debug(__FUNCTION__, "(end) deriv.ds_dr1 = {}", out.ds_dr1);
+    }
 
     return out;
 }
@@ -6,9 +6,7 @@
 
 #include "Seeder/BaseSeeder.hxx"
 #include "Seeder/SeederLineVertex.hxx"
-#if T2DS_DEBUG
 #include "App/Logger.hxx"
-#endif
 
 #include "Seeder/SeederLineLine.hxx"
 
@@ -91,14 +89,14 @@ std::pair<Seed, Seed> FastPCAs(double x01, double y01, double z01, double px01,
     seed2.pca.xyz = {x02 + c.px02 * seed2.ds, y02 + c.py02 * seed2.ds, z02 + c.pz02 * seed2.ds};
     seed2.pca.mom = {c.px02, c.py02, c.pz02};
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "seed1.ds = {:13.6e}", seed1.ds);
-    Logger::Debug(__FUNCTION__, "seed1.(x,y,z) = {}", seed1.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed1.(px,py,pz) = {}", seed1.pca.mom);
-    Logger::Debug(__FUNCTION__, "seed2.ds = {:13.6e}", seed2.ds);
-    Logger::Debug(__FUNCTION__, "seed2.(x,y,z) = {}", seed2.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed2.(px,py,pz) = {}", seed2.pca.mom);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "seed1.ds = {:13.6e}", seed1.ds);
+        Logger::Debug(__FUNCTION__, "seed1.(x,y,z) = {}", seed1.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed1.(px,py,pz) = {}", seed1.pca.mom);
+        Logger::Debug(__FUNCTION__, "seed2.ds = {:13.6e}", seed2.ds);
+        Logger::Debug(__FUNCTION__, "seed2.(x,y,z) = {}", seed2.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed2.(px,py,pz) = {}", seed2.pca.mom);
+    }
 
     return {seed1, seed2};
 }
@@ -157,12 +155,12 @@ std::pair<Deriv, Deriv> ComputeDerivatives(const Cache& c) {
         deriv2.ds_dr[i] = da2_dr2 / c.detp - a2 * ddetp_dr2[i] / detp2;
     }
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "deriv1.ds_dr = {}", deriv1.ds_dr);
-    Logger::Debug(__FUNCTION__, "deriv1.ds_dr1 = {}", deriv1.ds_dr1);
-    Logger::Debug(__FUNCTION__, "deriv2.ds_dr = {}", deriv2.ds_dr);
-    Logger::Debug(__FUNCTION__, "deriv2.ds_dr1 = {}", deriv2.ds_dr1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "deriv1.ds_dr = {}", deriv1.ds_dr);
+        Logger::Debug(__FUNCTION__, "deriv1.ds_dr1 = {}", deriv1.ds_dr1);
+        Logger::Debug(__FUNCTION__, "deriv2.ds_dr = {}", deriv2.ds_dr);
+        Logger::Debug(__FUNCTION__, "deriv2.ds_dr1 = {}", deriv2.ds_dr1);
+    }
 
     return {deriv1, deriv2};
 }
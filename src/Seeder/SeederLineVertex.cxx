@@ -4,9 +4,7 @@
 #include "common/Constants.hpp"
 
 #include "Seeder/BaseSeeder.hxx"
-#if T2DS_DEBUG
 #include "App/Logger.hxx"
-#endif
 
 #include "Seeder/SeederLineVertex.hxx"
 
@@ -57,11 +55,11 @@ Seed FastPCA(double x0, double y0, double z0, double px, double py, double pz,
     seed.pca.xyz = {x0 + c.px0 * seed.ds, y0 + c.py0 * seed.ds, z0 + c.pz0 * seed.ds};
     seed.pca.mom = {c.px0, c.py0, c.pz0};
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "seed.ds = {:13.6e}", seed.ds);
-    Logger::Debug(__FUNCTION__, "seed.(x,y,z) = {}", seed.pca.xyz);
-    Logger::Debug(__FUNCTION__, "seed.(px,py,pz) = {}", seed.pca.mom);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "seed.ds = {:13.6e}", seed.ds);
+        Logger::Debug(__FUNCTION__, "seed.(x,y,z) = {}", seed.pca.xyz);
+        Logger::Debug(__FUNCTION__, "seed.(px,py,pz) = {}", seed.pca.mom);
+    }
 
     return seed;
 }
@@ -88,10 +86,10 @@ Deriv ComputeDerivatives(const Cache& c) {
                  (c.dz * c.p2 - 2. * c.pz0 * c.a) / p4};
     out.ds_dr1 = {-out.ds_dr[0], -out.ds_dr[1], -out.ds_dr[2], 0., 0., 0.};
 
-#if T2DS_DEBUG
-    Logger::Debug(__FUNCTION__, "deriv.ds_dr = {}", out.ds_dr);
-    Logger::Debug(__FUNCTION__, "deriv.ds_dr1 = {}", out.ds_dr1);
-#endif
+    if (Logger::IsEnabled(Logger::ELevel::Debug)) {
+        Logger::Debug(__FUNCTION__, "deriv.ds_dr = {}", out.ds_dr);
+        Logger::Debug(__FUNCTION__, "deriv.ds_dr1 = {}", out.ds_dr1);
+    }
 
     return out;
 }
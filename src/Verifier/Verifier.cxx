@@ -26,13 +26,17 @@ namespace CMath = Common::Math;
 #include "Seeder/SeederHelixHelix.hxx"
 #include "Seeder/SeederLineLine.hxx"
 
+#include "App/Metrics.hxx"
+#include "App/Timers.hxx"
+
 #include "Verifier/Verifier.hxx"
 
 namespace T2DS {
 
 // ## OUTPUT ZONE ## //
 
-void Verifier::PrepareOutputHistograms() {
+template <bool IsMC>
+void Verifier<IsMC>::PrepareOutputHistograms() {
     // event counter
     fHist_EventCounter = std::make_unique<TH1D>("N_Events", ";N_Events;", 1, 0., 1.);
 
@@ -117,15 +121,24 @@ void Verifier::PrepareOutputHistograms() {
         x_axis->SetBinLabel(static_cast<int>(ELambdaPair::kPasses_Min_L2_DecayLength) + 1, "Passes_Min_L2_DecayLength");
         x_axis->SetBinLabel(static_cast<int>(ELambdaPair::kPasses_Min_L2_CPAwrtDV) + 1, "Passes_Min_L2_CPAwrtDV");
     }
+
+    // counters, folded into the histograms at the end //
+    fCutFlow_AntiLambda = CutFlow_PreFoundLambda(fHist_CutFlow_AntiLambda.get());
+    fCutFlow_Lambda = CutFlow_PreFoundLambda(fHist_CutFlow_Lambda.get());
+    fCutFlow_AntiHdibaryon = CutFlow_LambdaPair(fHist_CutFlow_AntiHdibaryon.get());
+    fCutFlow_Hdibaryon = CutFlow_LambdaPair(fHist_CutFlow_Hdibaryon.get());
+    fCutFlow_MixedLambdaPair = CutFlow_LambdaPair(fHist_CutFlow_MixedLambdaPair.get());
 }
 
 // ## Event ZONE ## //
 
-void Verifier::ProcessEvent() {
+template <bool IsMC>
+void Verifier<IsMC>::ProcessEvent() {
     // copy event info
     fOutput.Event = static_cast<POD::Event&>(fInput.Event);
-    if (fSettings.IsMC) {
+    if constexpr (IsMC) {
         fOutput.MC_Event = fInput.MC_Event;
+        fMcIndex.Build(fInput.McParticle);
     }
     // update event counter
     fHist_EventCounter->Fill(0.);
@@ -139,37 +152,44 @@ void Verifier::ProcessEvent() {
 
 // ## Injected ZONE ## //
 
-void Verifier::ProcessInjected() {
+template <bool IsMC>
+void Verifier<IsMC>::ProcessInjected()
+    requires IsMC
+{
     // loop over mc particles //
-    for (const auto& mc : fInput.McParticle) {
+    for (std::size_t mc_entry = 0; mc_entry < fInput.McParticle.size(); ++mc_entry) {
         // select only injected h-dibaryons //
-        if (std::abs(mc.PdgCode) != DB::Particles::Particle("Hdibaryon").pdg_code) continue;
+        if (std::abs(fInput.McParticle[mc_entry].PdgCode) != DB::Particles::Particle("Hdibaryon").pdg_code) continue;
         // store //
-        fOutput.Injected.emplace_back(BuildInjectedHdibaryon(mc));
+        fOutput.Injected.emplace_back(BuildInjectedHdibaryon(mc_entry));
     }
 }
 
-POD::InjectedHdib Verifier::BuildInjectedHdibaryon(const POD::McParticle& mc) {
+template <bool IsMC>
+POD::InjectedHdib Verifier<IsMC>::BuildInjectedHdibaryon(std::size_t mc_entry)
+    requires IsMC
+{
+    const POD::McParticle& mc = fInput.McParticle[mc_entry];
     POD::InjectedHdib inj;
     inj.SignalID = static_cast<int>(mc.StatusCode);
     inj.IsAntiChannel = mc.PdgCode == DB::Particles::Particle("AntiHdibaryon").pdg_code;
-    std::tie(inj.Decay_X, inj.Decay_Y, inj.Decay_Z) = MC::GetDecayVertex(mc, fInput.McParticle);
+    std::tie(inj.Decay_X, inj.Decay_Y, inj.Decay_Z) = fMcIndex.DecayVertex(mc_entry);
     inj.Px = mc.Px;
     inj.Py = mc.Py;
     inj.Pz = mc.Pz;
     inj.Energy = mc.Energy;
     // lambda 1
     if (mc.FirstDau_McEntry > Common::DummyInt) {
-        auto& mc_l1 = fInput.McParticle[static_cast<std::size_t>(mc.FirstDau_McEntry)];
-        std::tie(inj.Lambda1_Decay_X, inj.Lambda1_Decay_Y, inj.Lambda1_Decay_Z) = MC::GetDecayVertex(mc_l1, fInput.McParticle);
+        const auto entry_l1 = static_cast<std::size_t>(mc.FirstDau_McEntry);
+        auto& mc_l1 = fInput.McParticle[entry_l1];
+        std::tie(inj.Lambda1_Decay_X, inj.Lambda1_Decay_Y, inj.Lambda1_Decay_Z) = fMcIndex.DecayVertex(entry_l1);
         inj.Lambda1_Px = mc_l1.Px;
         inj.Lambda1_Py = mc_l1.Py;
         inj.Lambda1_Pz = mc_l1.Pz;
         inj.Lambda1_Energy = mc_l1.Energy;
         // lambda 1's proton daughter
-        auto entry_proton =
-            MC::FindDaughterMcEntry(mc_l1, fInput.McParticle,
-                                    inj.IsAntiChannel ? DB::Particles::Particle("AntiProton").pdg_code : DB::Particles::Particle("Proton").pdg_code);
+        auto entry_proton = fMcIndex.FindDaughter(
+            entry_l1, inj.IsAntiChannel ? DB::Particles::Particle("AntiProton").pdg_code : DB::Particles::Particle("Proton").pdg_code);
         if (entry_proton.has_value()) {
             auto& mc_proton = fInput.McParticle[entry_proton.value()];
             inj.Proton1_Px = mc_proton.Px;
@@ -178,8 +198,8 @@ POD::InjectedHdib Verifier::BuildInjectedHdibaryon(const POD::McParticle& mc) {
             inj.Proton1_Energy = mc_proton.Energy;
         }
         // lambda 1's pion daughter
-        auto entry_pion = MC::FindDaughterMcEntry(
-            mc_l1, fInput.McParticle, inj.IsAntiChannel ? DB::Particles::Particle("PiPlus").pdg_code : DB::Particles::Particle("PiMinus").pdg_code);
+        auto entry_pion = fMcIndex.FindDaughter(
+            entry_l1, inj.IsAntiChannel ? DB::Particles::Particle("PiPlus").pdg_code : DB::Particles::Particle("PiMinus").pdg_code);
         if (entry_pion.has_value()) {
             auto& mc_pion = fInput.McParticle[entry_pion.value()];
             inj.Pion1_Px = mc_pion.Px;
@@ -190,16 +210,16 @@ POD::InjectedHdib Verifier::BuildInjectedHdibaryon(const POD::McParticle& mc) {
     }
     // lambda 2
     if (mc.LastDau_McEntry > Common::DummyInt) {
-        auto& mc_l2 = fInput.McParticle[static_cast<std::size_t>(mc.LastDau_McEntry)];
-        std::tie(inj.Lambda2_Decay_X, inj.Lambda2_Decay_Y, inj.Lambda2_Decay_Z) = MC::GetDecayVertex(mc_l2, fInput.McParticle);
+        const auto entry_l2 = static_cast<std::size_t>(mc.LastDau_McEntry);
+        auto& mc_l2 = fInput.McParticle[entry_l2];
+        std::tie(inj.Lambda2_Decay_X, inj.Lambda2_Decay_Y, inj.Lambda2_Decay_Z) = fMcIndex.DecayVertex(entry_l2);
         inj.Lambda2_Px = mc_l2.Px;
         inj.Lambda2_Py = mc_l2.Py;
         inj.Lambda2_Pz = mc_l2.Pz;
         inj.Lambda2_Energy = mc_l2.Energy;
         // lambda 2's proton daughter
-        auto entry_proton =
-            MC::FindDaughterMcEntry(mc_l2, fInput.McParticle,
-                                    inj.IsAntiChannel ? DB::Particles::Particle("AntiProton").pdg_code : DB::Particles::Particle("Proton").pdg_code);
+        auto entry_proton = fMcIndex.FindDaughter(
+            entry_l2, inj.IsAntiChannel ? DB::Particles::Particle("AntiProton").pdg_code : DB::Particles::Particle("Proton").pdg_code);
         if (entry_proton.has_value()) {
             auto& mc_proton = fInput.McParticle[entry_proton.value()];
             inj.Proton2_Px = mc_proton.Px;
@@ -208,8 +228,8 @@ POD::InjectedHdib Verifier::BuildInjectedHdibaryon(const POD::McParticle& mc) {
             inj.Proton2_Energy = mc_proton.Energy;
         }
         // lambda 2's pion daughter
-        auto entry_pion = MC::FindDaughterMcEntry(
-            mc_l2, fInput.McParticle, inj.IsAntiChannel ? DB::Particles::Particle("PiPlus").pdg_code : DB::Particles::Particle("PiMinus").pdg_code);
+        auto entry_pion = fMcIndex.FindDaughter(
+            entry_l2, inj.IsAntiChannel ? DB::Particles::Particle("PiPlus").pdg_code : DB::Particles::Particle("PiMinus").pdg_code);
         if (entry_pion.has_value()) {
             auto& mc_pion = fInput.McParticle[entry_pion.value()];
             inj.Pion2_Px = mc_pion.Px;
@@ -224,7 +244,10 @@ POD::InjectedHdib Verifier::BuildInjectedHdibaryon(const POD::McParticle& mc) {
 
 // ## Charged Tracks ZONE ## //
 
-POD::Extended::McParticle Verifier::BuildMcTrack(unsigned int track_mc_entry, const HD::DecayTree& decay_pid, int pdg_code_hypothesis) {
+template <bool IsMC>
+POD::Extended::McParticle Verifier<IsMC>::BuildMcTrack(unsigned int track_mc_entry, const HD::DecayTree& decay_pid, int pdg_code_hypothesis)
+    requires IsMC
+{
     // copy linked mc info //
     POD::Extended::McParticle new_mc(fInput.McParticle[track_mc_entry]);
     MC::Apply(new_mc, MC::HdibaryonRules::ClassifyDownstream(new_mc, fInput.McParticle, decay_pid, pdg_code_hypothesis, false));
@@ -232,7 +255,8 @@ POD::Extended::McParticle Verifier::BuildMcTrack(unsigned int track_mc_entry, co
 }
 
 // Extract track information from a `POD::PreFoundLambda` as a `POD::Track`.
-POD::Track Verifier::ExtractTrack(const POD::PreFoundLambda& pod_lambda, short charge) const {
+template <bool IsMC>
+POD::Track Verifier<IsMC>::ExtractTrack(const POD::PreFoundLambda& pod_lambda, short charge) const {
     return {
         charge < 0 ? pod_lambda.Neg_EsdEntry : pod_lambda.Pos_EsdEntry,
         charge < 0 ? pod_lambda.Neg_State[0] : pod_lambda.Pos_State[0],
@@ -259,7 +283,10 @@ POD::Track Verifier::ExtractTrack(const POD::PreFoundLambda& pod_lambda, short c
 
 // ## Single Pre-Found Lambda ZONE ## //
 
-void Verifier::ProcessPreFoundLambda() {
+template <bool IsMC>
+void Verifier<IsMC>::ProcessPreFoundLambda() {
+
+    Timers::Scoped timer(Timers::ETimer::ProcessPreFoundLambda);
 
     constexpr FitSetup setup = GetFitSetup();
     const KF::FitPolicy fit_policy{
@@ -284,7 +311,8 @@ void Verifier::ProcessPreFoundLambda() {
         auto [seed_neg, seed_pos, pca_cache] = Seeder::HelixHelix::FastCorrectPCAs(track_neg, track_pos, fMagneticField);
 
         // apply cuts (2) //
-        if (!PostSeedCuts_Lambda(seed_neg.pca, seed_pos.pca)) continue;
+        const bool passes_seed_cuts = PostSeedCuts_Lambda(seed_neg.pca, seed_pos.pca);
+        if (!Metrics::CountCut(Metrics::ESelection::PreFoundLambda, Metrics::EStep::PostSeedCuts, passes_seed_cuts)) continue;
 
         // PCAs derivatives //
         auto [deriv_neg, deriv_pos] = Seeder::HelixHelix::ComputeDerivatives(seed_neg, seed_pos, pca_cache);
@@ -303,7 +331,8 @@ void Verifier::ProcessPreFoundLambda() {
             Cached::PreFoundLambda c_lambda(new_lambda, fPrimaryVertex);
 
             // apply more cuts (3) //
-            if (!PostFitCuts_Lambda(c_lambda)) continue;
+            const auto selection = anti_channel ? Metrics::ESelection::AntiLambda : Metrics::ESelection::Lambda;
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostFitCuts, PostFitCuts_Lambda(c_lambda))) continue;
 
             // store reconstructed //
             if (anti_channel) {
@@ -313,22 +342,22 @@ void Verifier::ProcessPreFoundLambda() {
             }
 
             // store mc //
-            if (!fSettings.IsMC) continue;
-
-            // -- build mc particles
-            auto mc_lambda_neg = BuildMcTrack(fInput.PreFoundLambda_Neg_McEntry[entry_lambda], decay_tree, decay_tree.neg.pdg_code);
-            auto mc_lambda_pos = BuildMcTrack(fInput.PreFoundLambda_Pos_McEntry[entry_lambda], decay_tree, decay_tree.pos.pdg_code);
-            auto mc_lambda = BuildMcPreFoundLambda(mc_lambda_neg, mc_lambda_pos, decay_tree);
-
-            // -- store
-            if (anti_channel) {
-                fTemp_MC_AntiLambda.emplace_back(mc_lambda);
-                fTemp_MC_AntiLambda_Neg.emplace_back(mc_lambda_neg);
-                fTemp_MC_AntiLambda_Pos.emplace_back(mc_lambda_pos);
-            } else {
-                fTemp_MC_Lambda.emplace_back(mc_lambda);
-                fTemp_MC_Lambda_Neg.emplace_back(mc_lambda_neg);
-                fTemp_MC_Lambda_Pos.emplace_back(mc_lambda_pos);
+            if constexpr (IsMC) {
+                // -- build mc particles
+                auto mc_lambda_neg = BuildMcTrack(fInput.PreFoundLambda_Neg_McEntry[entry_lambda], decay_tree, decay_tree.neg.pdg_code);
+                auto mc_lambda_pos = BuildMcTrack(fInput.PreFoundLambda_Pos_McEntry[entry_lambda], decay_tree, decay_tree.pos.pdg_code);
+                auto mc_lambda = BuildMcPreFoundLambda(mc_lambda_neg, mc_lambda_pos, decay_tree);
+
+                // -- store
+                if (anti_channel) {
+                    fTemp_MC_AntiLambda.emplace_back(mc_lambda);
+                    fTemp_MC_AntiLambda_Neg.emplace_back(mc_lambda_neg);
+                    fTemp_MC_AntiLambda_Pos.emplace_back(mc_lambda_pos);
+                } else {
+                    fTemp_MC_Lambda.emplace_back(mc_lambda);
+                    fTemp_MC_Lambda_Neg.emplace_back(mc_lambda_neg);
+                    fTemp_MC_Lambda_Pos.emplace_back(mc_lambda_pos);
+                }
             }
         }
     }  // end of loop over pre-found (anti)lambdas
@@ -336,7 +365,8 @@ void Verifier::ProcessPreFoundLambda() {
 
 // Among duplicates, keep the one with the tightest pre-fit vertex; ties go to the lower entry.
 // NOTE: order-independent on purpose -- "keep the first" would let a worse twin evict a better one.
-bool Verifier::IsDuplicatedPreFoundLambda(std::size_t entry_lambda) const {
+template <bool IsMC>
+bool Verifier<IsMC>::IsDuplicatedPreFoundLambda(std::size_t entry_lambda) const {
     const auto& lambda = fInput.PreFoundLambda[entry_lambda];
     for (std::size_t entry_other = 0; entry_other < fInput.PreFoundLambda.size(); ++entry_other) {
         if (entry_other == entry_lambda) continue;
@@ -353,96 +383,102 @@ bool Verifier::IsDuplicatedPreFoundLambda(std::size_t entry_lambda) const {
     return false;
 }
 
-bool Verifier::PreSeedCuts_Lambda(const POD::PreFoundLambda& lambda, std::size_t entry_lambda) {
-    FillHist(fHist_CutFlow_AntiLambda.get(), EPreFoundLambda::kAllPreFoundLambdas);
-    FillHist(fHist_CutFlow_Lambda.get(), EPreFoundLambda::kAllPreFoundLambdas);
+template <bool IsMC>
+bool Verifier<IsMC>::PreSeedCuts_Lambda(const POD::PreFoundLambda& lambda, std::size_t entry_lambda) {
+    FillHist(&fCutFlow_AntiLambda, EPreFoundLambda::kAllPreFoundLambdas);
+    FillHist(&fCutFlow_Lambda, EPreFoundLambda::kAllPreFoundLambdas);
 
     if (HD::SameDaughterEntries(lambda)) return false;
-    FillHist(fHist_CutFlow_AntiLambda.get(), EPreFoundLambda::kPasses_DiffDaughters_Logical);
-    FillHist(fHist_CutFlow_Lambda.get(), EPreFoundLambda::kPasses_DiffDaughters_Logical);
+    FillHist(&fCutFlow_AntiLambda, EPreFoundLambda::kPasses_DiffDaughters_Logical);
+    FillHist(&fCutFlow_Lambda, EPreFoundLambda::kPasses_DiffDaughters_Logical);
 
     if (CMath::IsSameHelix(lambda.Neg_State, lambda.Pos_State, Cuts::PreFoundLambda::Max_TracksDeltaR, Cuts::PreFoundLambda::Max_TracksRelDeltaP)) {
         return false;
     }
-    FillHist(fHist_CutFlow_AntiLambda.get(), EPreFoundLambda::kPasses_DiffDaughters_Physical);
-    FillHist(fHist_CutFlow_Lambda.get(), EPreFoundLambda::kPasses_DiffDaughters_Physical);
+    FillHist(&fCutFlow_AntiLambda, EPreFoundLambda::kPasses_DiffDaughters_Physical);
+    FillHist(&fCutFlow_Lambda, EPreFoundLambda::kPasses_DiffDaughters_Physical);
 
     if (IsDuplicatedPreFoundLambda(entry_lambda)) return false;
-    FillHist(fHist_CutFlow_AntiLambda.get(), EPreFoundLambda::kPasses_NotDuplicated);
-    FillHist(fHist_CutFlow_Lambda.get(), EPreFoundLambda::kPasses_NotDuplicated);
+    FillHist(&fCutFlow_AntiLambda, EPreFoundLambda::kPasses_NotDuplicated);
+    FillHist(&fCutFlow_Lambda, EPreFoundLambda::kPasses_NotDuplicated);
 
     return true;
 }
 
-bool Verifier::PostSeedCuts_Lambda(const Seeder::PCA& pca_neg, const Seeder::PCA& pca_pos) {
+template <bool IsMC>
+bool Verifier<IsMC>::PostSeedCuts_Lambda(const Seeder::PCA& pca_neg, const Seeder::PCA& pca_pos) {
 
     // if (CMath::Distance(pca_neg.xyz, pca_pos.xyz) > Cuts::PreFoundLambda::Max_DCAbtwDaughters) return false; // PENDING: temporarily turned off
-    // FillHist(fHist_CutFlow_AntiLambda.get(), EPreFoundLambda::kPasses_Max_DCAbtwDaughters); // PENDING: temporarily turned off
-    // FillHist(fHist_CutFlow_Lambda.get(), EPreFoundLambda::kPasses_Max_DCAbtwDaughters); // PENDING: temporarily turned off
+    // FillHist(&fCutFlow_AntiLambda, EPreFoundLambda::kPasses_Max_DCAbtwDaughters); // PENDING: temporarily turned off
+    // FillHist(&fCutFlow_Lambda, EPreFoundLambda::kPasses_Max_DCAbtwDaughters); // PENDING: temporarily turned off
 
     return true;
 }
 
-bool Verifier::PostFitCuts_Lambda(const Cached::PreFoundLambda& c_lambda) {
-    auto* hist_cut_flow = c_lambda.IsAntiLambda ? fHist_CutFlow_AntiLambda.get() : fHist_CutFlow_Lambda.get();
+template <bool IsMC>
+bool Verifier<IsMC>::PostFitCuts_Lambda(const Cached::PreFoundLambda& c_lambda) {
+    auto* cut_flow = c_lambda.IsAntiLambda ? &fCutFlow_AntiLambda : &fCutFlow_Lambda;
 
     if (std::abs(static_cast<double>(c_lambda.Pz)) > Cuts::PreFoundLambda::AbsMax_Pz) return false;
-    FillHist(hist_cut_flow, EPreFoundLambda::kPasses_AbsMax_Pz);
+    FillHist(cut_flow, EPreFoundLambda::kPasses_AbsMax_Pz);
 
     if (c_lambda.Pt() > Cuts::PreFoundLambda::Max_Pt) return false;
-    FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Max_Pt);
+    FillHist(cut_flow, EPreFoundLambda::kPasses_Max_Pt);
 
     // if (c_lambda.Pt() < Cuts::PreFoundLambda::Min_Pt) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Min_Pt); // PENDING: temporarily turned off
+    // FillHist(cut_flow, EPreFoundLambda::kPasses_Min_Pt); // PENDING: temporarily turned off
 
     if (std::abs(c_lambda.Rapidity()) > Cuts::PreFoundLambda::AbsMax_Rapidity) return false;
-    FillHist(hist_cut_flow, EPreFoundLambda::kPasses_AbsMax_Rapidity);
+    FillHist(cut_flow, EPreFoundLambda::kPasses_AbsMax_Rapidity);
 
     // if (c_lambda.Mass() < Cuts::PreFoundLambda::Min_Mass) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Min_Mass); // PENDING: temporarily turned off
+    // FillHist(cut_flow, EPreFoundLambda::kPasses_Min_Mass); // PENDING: temporarily turned off
 
     // if (c_lambda.Mass() > Cuts::PreFoundLambda::Max_Mass) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Max_Mass); // PENDING: temporarily turned off
+    // FillHist(cut_flow, EPreFoundLambda::kPasses_Max_Mass); // PENDING: temporarily turned off
 
     if (c_lambda.CPA_wrt_PV() < Cuts::PreFoundLambda::Min_CPAwrtPV) return false;
-    FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Min_CPAwrtPV);
+    FillHist(cut_flow, EPreFoundLambda::kPasses_Min_CPAwrtPV);
 
     if (std::abs(c_lambda.ArmRadiusDev()) > Cuts::PreFoundLambda::AbsMax_ArmRadiusDev) return false;
-    FillHist(hist_cut_flow, EPreFoundLambda::kPasses_AbsMax_ArmRadiusDev);
+    FillHist(cut_flow, EPreFoundLambda::kPasses_AbsMax_ArmRadiusDev);
 
     // if (c_lambda.DCA_wrt_PV() > Cuts::PreFoundLambda::Max_DCAwrtPV) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Max_DCAwrtPV); // PENDING: temporarily turned off
+    // FillHist(cut_flow, EPreFoundLambda::kPasses_Max_DCAwrtPV); // PENDING: temporarily turned off
 
     if (static_cast<double>(c_lambda.Chi2NDF) > 2.5) return false;
-    FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Max_Chi2NDF);
+    FillHist(cut_flow, EPreFoundLambda::kPasses_Max_Chi2NDF);
 
     // depend on (anti)protons //
 
     if (std::abs(c_lambda.Pr_Pz()) > Cuts::PreFoundLambda::AbsMax_Pz_Proton) return false;
-    FillHist(hist_cut_flow, EPreFoundLambda::kPasses_AbsMax_Pz_Proton);
+    FillHist(cut_flow, EPreFoundLambda::kPasses_AbsMax_Pz_Proton);
 
     if (c_lambda.Pr_Pt() > Cuts::PreFoundLambda::Max_Pt_Proton) return false;
-    FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Max_Pt_Proton);
+    FillHist(cut_flow, EPreFoundLambda::kPasses_Max_Pt_Proton);
 
     // if (c_lambda.Pr_Pt() < Cuts::PreFoundLambda::Min_Pt_Proton) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Min_Pt_Proton); // PENDING: temporarily turned off
+    // FillHist(cut_flow, EPreFoundLambda::kPasses_Min_Pt_Proton); // PENDING: temporarily turned off
 
     // depend on pi(minus/plus) //
 
     if (std::abs(c_lambda.Pi_Pz()) > Cuts::PreFoundLambda::AbsMax_Pz_Pion) return false;
-    FillHist(hist_cut_flow, EPreFoundLambda::kPasses_AbsMax_Pz_Pion);
+    FillHist(cut_flow, EPreFoundLambda::kPasses_AbsMax_Pz_Pion);
 
     if (c_lambda.Pi_Pt() > Cuts::PreFoundLambda::Max_Pt_Pion) return false;
-    FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Max_Pt_Pion);
+    FillHist(cut_flow, EPreFoundLambda::kPasses_Max_Pt_Pion);
 
     // if (c_lambda.Pi_Pt() < Cuts::PreFoundLambda::Min_Pt_Pion) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, EPreFoundLambda::kPasses_Min_Pt_Pion); // PENDING: temporarily turned off
+    // FillHist(cut_flow, EPreFoundLambda::kPasses_Min_Pt_Pion); // PENDING: temporarily turned off
 
     return true;
 }
 
-POD::Extended::McParticle Verifier::BuildMcPreFoundLambda(const POD::Extended::McParticle& mc_neg, const POD::Extended::McParticle& mc_pos,
-                                                          const HD::DecayTree& decay_pid) {
+template <bool IsMC>
+POD::Extended::McParticle Verifier<IsMC>::BuildMcPreFoundLambda(const POD::Extended::McParticle& mc_neg, const POD::Extended::McParticle& mc_pos,
+                                                                const HD::DecayTree& decay_pid)
+    requires IsMC
+{
     POD::Extended::McParticle mc_lambda;
 
     // -- fill hybridness, independently of no common mother
@@ -458,8 +494,9 @@ POD::Extended::McParticle Verifier::BuildMcPreFoundLambda(const POD::Extended::M
     return mc_lambda;
 }
 
-POD::Extended::PreFoundLambda Verifier::CreateExtendedPreFoundLambda(const POD::PreFoundLambda& old_lambda, const KF::FitResult& fit,
-                                                                     const Seeder::PCA& pca_neg, const Seeder::PCA& pca_pos, bool anti_lambda) {
+template <bool IsMC>
+POD::Extended::PreFoundLambda Verifier<IsMC>::CreateExtendedPreFoundLambda(const POD::PreFoundLambda& old_lambda, const KF::FitResult& fit,
+                                                                           const Seeder::PCA& pca_neg, const Seeder::PCA& pca_pos, bool anti_lambda) {
     // profit from initialization list to extend data
     POD::Extended::PreFoundLambda new_lambda{old_lambda,
                                              static_cast<float>(fit.mother.Px()),
@@ -500,7 +537,10 @@ POD::Extended::PreFoundLambda Verifier::CreateExtendedPreFoundLambda(const POD::
 
 // ## H-dibaryon ZONE ## //
 
-void Verifier::VerifyLambdaPair(bool anti_channel_l1, bool anti_channel_l2) {
+template <bool IsMC>
+void Verifier<IsMC>::VerifyLambdaPair(bool anti_channel_l1, bool anti_channel_l2) {
+
+    Timers::Scoped timer(Timers::ETimer::VerifyLambdaPair);
 
     // determine rules based on the species assigned to each (anti)lambda //
     // -- the mixed channel is the lambda + anti-lambda background, which no (anti)h-dibaryon can decay into
@@ -512,9 +552,12 @@ void Verifier::VerifyLambdaPair(bool anti_channel_l1, bool anti_channel_l2) {
     // NOTE: "Unknown" carries a pdg code no true particle can match, so the mixed channel is never labelled as signal
     const int pdg_code_hypothesis = mixed_channel ? DB::Particles::Particle("Unknown").pdg_code : decay_pid_l1.hdibaryon.pdg_code;
 
-    auto* hist_cut_flow = mixed_channel  ? fHist_CutFlow_MixedLambdaPair.get()
-                          : anti_channel ? fHist_CutFlow_AntiHdibaryon.get()
-                                         : fHist_CutFlow_Hdibaryon.get();
+    auto* cut_flow = mixed_channel  ? &fCutFlow_MixedLambdaPair
+                     : anti_channel ? &fCutFlow_AntiHdibaryon
+                                    : &fCutFlow_Hdibaryon;
+    const auto selection = mixed_channel  ? Metrics::ESelection::MixedLambdaPair
+                           : anti_channel ? Metrics::ESelection::AntiHdibaryon
+                                          : Metrics::ESelection::Hdibaryon;
 
     const auto& input_lambdas_l1 = anti_channel_l1 ? fTemp_AntiLambda : fTemp_Lambda;
     const auto& input_mc_lambdas_l1 = anti_channel_l1 ? fTemp_MC_AntiLambda : fTemp_MC_Lambda;
@@ -544,14 +587,15 @@ void Verifier::VerifyLambdaPair(bool anti_channel_l1, bool anti_channel_l2) {
             const auto& lambda2 = input_lambdas_l2[entry_lambda2];  // cache index lookup
 
             // logical cuts (1) //
-            if (!PreSeedCuts_Hdibaryon(lambda1, lambda2, hist_cut_flow)) continue;
+            if (!PreSeedCuts_Hdibaryon(lambda1, lambda2, cut_flow)) continue;
 
             // PCAs //
             Seeder::LineLine::Cache pca_cache;
             auto [seed_lambda1, seed_lambda2] = Seeder::LineLine::FastPCAs(lambda1, lambda2, &pca_cache);
 
             // apply cuts (2) //
-            if (!PostSeedCuts_Hdibaryon(seed_lambda1.pca, seed_lambda2.pca, hist_cut_flow)) continue;
+            const bool passes_seed_cuts = PostSeedCuts_Hdibaryon(seed_lambda1.pca, seed_lambda2.pca, cut_flow);
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostSeedCuts, passes_seed_cuts)) continue;
 
             // PCAs derivatives //
             auto [deriv_lambda1, deriv_lambda2] = Seeder::LineLine::ComputeDerivatives(pca_cache);
@@ -565,7 +609,7 @@ void Verifier::VerifyLambdaPair(bool anti_channel_l1, bool anti_channel_l2) {
             Cached::Hdibaryon c_hdib(hdib, lambda1, lambda2, fPrimaryVertex);
 
             // apply cuts (2) //
-            if (!PostFitCuts_Hdibaryon(c_hdib, hist_cut_flow)) continue;
+            if (!Metrics::CountCut(selection, Metrics::EStep::PostFitCuts, PostFitCuts_Hdibaryon(c_hdib, cut_flow))) continue;
 
             // store reconstructed //
             fOutput.Hdibaryon.emplace_back(hdib);
@@ -573,7 +617,7 @@ void Verifier::VerifyLambdaPair(bool anti_channel_l1, bool anti_channel_l2) {
             fOutput.Lambda2.emplace_back(lambda2);
 
             // store mc //
-            if (fSettings.IsMC) {
+            if constexpr (IsMC) {
                 fOutput.MC_Hdibaryon.emplace_back(
                     BuildMcHdibaryon(input_mc_lambdas_l1[entry_lambda1], input_mc_lambdas_l2[entry_lambda2], pdg_code_hypothesis));
                 fOutput.MC_Lambda1.emplace_back(input_mc_lambdas_l1[entry_lambda1]);
@@ -587,90 +631,96 @@ void Verifier::VerifyLambdaPair(bool anti_channel_l1, bool anti_channel_l2) {
     }  // end of loop over lambda1
 }
 
-bool Verifier::PreSeedCuts_Hdibaryon(const POD::Extended::PreFoundLambda& lambda1, const POD::Extended::PreFoundLambda& lambda2,
-                                     TH1D* hist_cut_flow) {
-    FillHist(hist_cut_flow, ELambdaPair::kAllCombinations);
+template <bool IsMC>
+bool Verifier<IsMC>::PreSeedCuts_Hdibaryon(const POD::Extended::PreFoundLambda& lambda1, const POD::Extended::PreFoundLambda& lambda2,
+                                           CutFlow_LambdaPair* cut_flow) {
+    FillHist(cut_flow, ELambdaPair::kAllCombinations);
 
     if (HD::SameLambdasEntries(lambda1, lambda2)) return false;  // order is important; apply this before `SameDaughterEntries()`
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_DiffLambdas_Logical);
+    FillHist(cut_flow, ELambdaPair::kPasses_DiffLambdas_Logical);
 
     if (HD::SameDaughterEntries(lambda1, lambda2)) return false;
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_DiffTracks_Logical);
+    FillHist(cut_flow, ELambdaPair::kPasses_DiffTracks_Logical);
 
     if (CMath::IsSameHelix(lambda1.Neg_State, lambda2.Neg_State, Cuts::PreFoundLambda::Max_TracksDeltaR, Cuts::PreFoundLambda::Max_TracksRelDeltaP) &&
         CMath::IsSameHelix(lambda1.Pos_State, lambda2.Pos_State, Cuts::PreFoundLambda::Max_TracksDeltaR, Cuts::PreFoundLambda::Max_TracksRelDeltaP)) {
         return false;
     }
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_DiffTracks_Physical);
+    FillHist(cut_flow, ELambdaPair::kPasses_DiffTracks_Physical);
 
     if (CMath::Distance(lambda1.Decay_X, lambda1.Decay_Y, lambda1.Decay_Z, lambda2.Decay_X, lambda2.Decay_Y, lambda2.Decay_Z) <
         Cuts::LambdaPair::Min_DistBtwLambdaDVs) {
         return false;
     }
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_DiffLambdas_Physical);
+    FillHist(cut_flow, ELambdaPair::kPasses_DiffLambdas_Physical);
 
     return true;
 }
 
-bool Verifier::PostSeedCuts_Hdibaryon(const Seeder::PCA& pca_lambda1, const Seeder::PCA& pca_lambda2, TH1D* hist_cut_flow) {
+template <bool IsMC>
+bool Verifier<IsMC>::PostSeedCuts_Hdibaryon(const Seeder::PCA& pca_lambda1, const Seeder::PCA& pca_lambda2, CutFlow_LambdaPair* cut_flow) {
 
     // if (CMath::Distance(pca_lambda1.xyz, pca_lambda2.xyz) > Cuts::LambdaPair::Max_DCAbtwDau) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, ELambdaPair::kPasses_Max_DCAbtwDau); // PENDING: temporarily turned off
+    // FillHist(cut_flow, ELambdaPair::kPasses_Max_DCAbtwDau); // PENDING: temporarily turned off
 
     return true;
 }
 
-bool Verifier::PostFitCuts_Hdibaryon(const Cached::Hdibaryon& c_hdib, TH1D* hist_cut_flow) {
+template <bool IsMC>
+bool Verifier<IsMC>::PostFitCuts_Hdibaryon(const Cached::Hdibaryon& c_hdib, CutFlow_LambdaPair* cut_flow) {
 
     if (std::abs(static_cast<double>(c_hdib.Pz)) > Cuts::LambdaPair::AbsMax_Pz) return false;
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_AbsMax_Pz);
+    FillHist(cut_flow, ELambdaPair::kPasses_AbsMax_Pz);
 
     if (c_hdib.Pt() > Cuts::LambdaPair::Max_Pt) return false;
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_Max_Pt);
+    FillHist(cut_flow, ELambdaPair::kPasses_Max_Pt);
 
     if (c_hdib.Pt() < Cuts::LambdaPair::Min_Pt) return false;
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_Min_Pt);
+    FillHist(cut_flow, ELambdaPair::kPasses_Min_Pt);
 
     if (std::abs(c_hdib.Rapidity()) > Cuts::LambdaPair::AbsMax_Rapidity) return false;
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_AbsMax_Rapidity);
+    FillHist(cut_flow, ELambdaPair::kPasses_AbsMax_Rapidity);
 
     // if (static_cast<double>(c_hdib.DecayLength) > Cuts::LambdaPair::Max_DecayLength) return false; // PENDING: temporarily turned off, need to
-    // re-tune FillHist(hist_cut_flow, ELambdaPair::kPasses_Max_DecayLength); // PENDING: temporarily turned off, need to re-tune
+    // re-tune FillHist(cut_flow, ELambdaPair::kPasses_Max_DecayLength); // PENDING: temporarily turned off, need to re-tune
 
     // if (c_hdib.CPA_wrt_PV() < Cuts::LambdaPair::Min_CPAwrtPV) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, ELambdaPair::kPasses_Min_CPAwrtPV); // PENDING: temporarily turned off
+    // FillHist(cut_flow, ELambdaPair::kPasses_Min_CPAwrtPV); // PENDING: temporarily turned off
 
     if (static_cast<double>(c_hdib.Chi2NDF) > Cuts::LambdaPair::Max_Chi2NDF) return false;
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_Max_Chi2NDF);
+    FillHist(cut_flow, ELambdaPair::kPasses_Max_Chi2NDF);
 
     if (static_cast<double>(c_hdib.Chi2CV) > 5.) return false;
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_Max_Chi2CV);
+    FillHist(cut_flow, ELambdaPair::kPasses_Max_Chi2CV);
 
     // (anti)lambda : depend on (anti)h-dibaryon decay vertex //
 
     if (c_hdib.Lambda1_DecayLength() > Cuts::PreFoundLambda::Max_DecayLength) return false;
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_Max_L1_DecayLength);
+    FillHist(cut_flow, ELambdaPair::kPasses_Max_L1_DecayLength);
 
     // if (c_hdib.Lambda1_DecayLength() < Cuts::PreFoundLambda::Min_DecayLength) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, ELambdaPair::kPasses_Min_L1_DecayLength); // PENDING: temporarily turned off
+    // FillHist(cut_flow, ELambdaPair::kPasses_Min_L1_DecayLength); // PENDING: temporarily turned off
 
     // if (c_hdib.Lambda1_CPA_wrt_DV() < Cuts::PreFoundLambda::Min_CPAwrtDV) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, ELambdaPair::kPasses_Min_L1_CPAwrtDV); // PENDING: temporarily turned off
+    // FillHist(cut_flow, ELambdaPair::kPasses_Min_L1_CPAwrtDV); // PENDING: temporarily turned off
 
     if (c_hdib.Lambda2_DecayLength() > Cuts::PreFoundLambda::Max_DecayLength) return false;
-    FillHist(hist_cut_flow, ELambdaPair::kPasses_Max_L2_DecayLength);
+    FillHist(cut_flow, ELambdaPair::kPasses_Max_L2_DecayLength);
 
     // if (c_hdib.Lambda2_DecayLength() < Cuts::PreFoundLambda::Min_DecayLength) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, ELambdaPair::kPasses_Min_L2_DecayLength); // PENDING: temporarily turned off
+    // FillHist(cut_flow, ELambdaPair::kPasses_Min_L2_DecayLength); // PENDING: temporarily turned off
 
     // if (c_hdib.Lambda2_CPA_wrt_DV() < Cuts::PreFoundLambda::Min_CPAwrtDV) return false; // PENDING: temporarily turned off
-    // FillHist(hist_cut_flow, ELambdaPair::kPasses_Min_L2_CPAwrtDV); // PENDING: temporarily turned off
+    // FillHist(cut_flow, ELambdaPair::kPasses_Min_L2_CPAwrtDV); // PENDING: temporarily turned off
 
     return true;
 }
 
-POD::Extended::McParticle Verifier::BuildMcHdibaryon(const POD::Extended::McParticle& mc_lambda1, const POD::Extended::McParticle& mc_lambda2,
-                                                     int pdg_code_hypothesis) {
+template <bool IsMC>
+POD::Extended::McParticle Verifier<IsMC>::BuildMcHdibaryon(const POD::Extended::McParticle& mc_lambda1, const POD::Extended::McParticle& mc_lambda2,
+                                                           int pdg_code_hypothesis)
+    requires IsMC
+{
     POD::Extended::McParticle mc_hdib;
 
     // -- fill hybridness, independently of no common mother
@@ -703,7 +753,8 @@ POD::Extended::McParticle Verifier::BuildMcHdibaryon(const POD::Extended::McPart
     return mc_hdib;
 }
 
-POD::LambdaPair Verifier::CreateLambdaPair(const KF::FitResult& fit, const Seeder::PCA& pca_lambda1, const Seeder::PCA& pca_lambda2) {
+template <bool IsMC>
+POD::LambdaPair Verifier<IsMC>::CreateLambdaPair(const KF::FitResult& fit, const Seeder::PCA& pca_lambda1, const Seeder::PCA& pca_lambda2) {
     POD::LambdaPair new_hdib;
     // candidate info
     new_hdib.Decay_X = static_cast<float>(fit.mother.X());
@@ -748,32 +799,38 @@ POD::LambdaPair Verifier::CreateLambdaPair(const KF::FitResult& fit, const Seede
 // ## END OF CYCLES ## //
 
 // Only fill events that have h-dibaryon candidates.
-void Verifier::EndOfEvent() {
+template <bool IsMC>
+void Verifier<IsMC>::EndOfEvent() {
     // clear temporary vectors
-    fTemp_AntiLambda.clear();
-    fTemp_Lambda.clear();
-    if (fSettings.IsMC) {
-        fTemp_MC_AntiLambda.clear();
-        fTemp_MC_AntiLambda_Neg.clear();
-        fTemp_MC_AntiLambda_Pos.clear();
-        fTemp_MC_Lambda.clear();
-        fTemp_MC_Lambda_Neg.clear();
-        fTemp_MC_Lambda_Pos.clear();
+    Drop(fTemp_AntiLambda);
+    Drop(fTemp_Lambda);
+    if constexpr (IsMC) {
+        Drop(fTemp_MC_AntiLambda);
+        Drop(fTemp_MC_AntiLambda_Neg);
+        Drop(fTemp_MC_AntiLambda_Pos);
+        Drop(fTemp_MC_Lambda);
+        Drop(fTemp_MC_Lambda_Neg);
+        Drop(fTemp_MC_Lambda_Pos);
     }
+    fMemory.Release();
 
     // if data, don't keep event with no candidates
-    if (!fSettings.IsMC && fOutput.Hdibaryon.empty()) return;
+    if (!IsMC && fOutput.Hdibaryon.empty()) return;
     // if mc, keep event with injected or reconstructed candidates
-    if (fSettings.IsMC && fOutput.Hdibaryon.empty() && fOutput.Injected.empty()) return;
+    if (IsMC && fOutput.Hdibaryon.empty() && fOutput.Injected.empty()) return;
 
     // fill schema
-    fWriter->Fill();
+    {
+        Timers::Scoped timer(Timers::ETimer::WriterFill);
+        fWriter->Fill();
+    }
 
     // clear schema
-    fOutput.Clear(fSettings.IsMC);
+    fOutput.Clear(IsMC);
 }
 
-bool Verifier::EndOfAnalysis() {
+template <bool IsMC>
+bool Verifier<IsMC>::EndOfAnalysis() {
 
     Logger::Info(__FUNCTION__, "The following objects have been written into TFile \"{}\":", fSettings.PathOutputFile);
 
@@ -781,6 +838,12 @@ bool Verifier::EndOfAnalysis() {
 
     // write histograms //
 
+    fCutFlow_AntiLambda.Fold();
+    fCutFlow_Lambda.Fold();
+    fCutFlow_AntiHdibaryon.Fold();
+    fCutFlow_Hdibaryon.Fold();
+    fCutFlow_MixedLambdaPair.Fold();
+
     fOutput_File->cd();
 
     // -- event counter
@@ -804,4 +867,9 @@ bool Verifier::EndOfAnalysis() {
     return fHist_EventCounter->GetEntries() != 0;
 }
 
+// ## Instantiations ZONE ## //
+
+template class Verifier<false>;
+template class Verifier<true>;
+
 }  // namespace T2DS